@@ -0,0 +1,367 @@
+/**
+ * @file Benchmark.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for Benchmark.h++, including the counting global
+ * operator new and the instruction counter
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "Benchmark.h++"
+
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <new>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace FluidEngine::Benchmarking;
+using FluidEngine::Abstraction::Acknowledgement;
+
+static std::atomic<std::size_t> allocationCount = 0;
+static std::atomic<std::size_t> allocatedBytes = 0;
+
+/**
+ * @brief malloc, counted
+ *
+ */
+static void* CountedAllocate(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    void* memory = std::malloc(size ? size : 1);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+/**
+ * @brief aligned_alloc, counted
+ *
+ */
+static void* CountedAllocate(std::size_t size, std::align_val_t alignment)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    // aligned_alloc wants a multiple of the alignment
+    const std::size_t bytes = (std::size_t)alignment;
+    void* memory = std::aligned_alloc
+    (
+        bytes,
+        (size + bytes - 1) / bytes * bytes + (size ? 0 : bytes)
+    );
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+//-----------------------------------------------------------------------------
+// The replaced global allocation functions. Everything else (nothrow, sized
+// delete...) ends up in these.
+//-----------------------------------------------------------------------------
+
+void* operator new(std::size_t size)
+{
+    return CountedAllocate(size);
+}
+void* operator new[](std::size_t size)
+{
+    return CountedAllocate(size);
+}
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, alignment);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return CountedAllocate(size, alignment);
+}
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    std::free(memory);
+}
+
+std::size_t FluidEngine::Benchmarking::AllocationCount() noexcept
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+std::size_t FluidEngine::Benchmarking::AllocatedBytes() noexcept
+{
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief The perf_event file descriptor counting this thread's user space
+ * instructions, or -1 if there is none (not Linux, no hardware counters in
+ * a VM, perf_event_paranoid too strict...)
+ *
+ */
+static int InstructionCounter() noexcept
+{
+#ifdef __linux__
+    static const int counter = []()
+    {
+        perf_event_attr attributes = {};
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        return (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+    }();
+    return counter;
+#else
+    return -1;
+#endif
+}
+
+bool FluidEngine::Benchmarking::CountsInstructions() noexcept
+{
+    return InstructionCounter() >= 0;
+}
+
+std::uint64_t FluidEngine::Benchmarking::InstructionCount() noexcept
+{
+    std::uint64_t count = 0;
+#ifdef __linux__
+    if
+    (
+        !CountsInstructions() ||
+        read(InstructionCounter(), &count, sizeof(count)) != sizeof(count)
+    )
+    {
+        return 0;
+    }
+#endif
+    return count;
+}
+
+void BenchmarkSuite::Record(const BenchmarkResult& result) noexcept
+{
+    this->results.push_back(result);
+
+    std::wcout << std::left << std::setw(68) << result.name << std::right
+               << std::fixed << std::setprecision(2)
+               << std::setw(10) << result.nanosecondsPerOperation
+               << L" ns/op" << std::setw(16) << std::setprecision(0)
+               << result.operationsPerSecond << L" ops/s"
+               << std::setw(8) << std::setprecision(3)
+               << result.allocationsPerOperation << L" allocs/op";
+    if (!std::isnan(result.instructionsPerOperation))
+    {
+        std::wcout << std::setw(10) << std::setprecision(1)
+                   << result.instructionsPerOperation << L" instructions/op";
+    }
+    std::wcout << L'\n' << std::defaultfloat;
+}
+
+const std::vector<BenchmarkResult>& BenchmarkSuite::GetResults()
+const noexcept
+{
+    return this->results;
+}
+
+/**
+ * @brief Writes a name as a JSON string (names are plain ASCII, but quotes
+ * and backslashes still need escaping)
+ *
+ */
+static void WriteJSONString(std::wostream& out, const std::wstring& text)
+{
+    out << L'"';
+    for (const wchar_t character : text)
+    {
+        if (character == L'"' || character == L'\\')
+        {
+            out << L'\\';
+        }
+        out << character;
+    }
+    out << L'"';
+}
+
+Acknowledgement BenchmarkSuite::WriteJSON(const std::string& path)
+const noexcept
+{
+    std::wofstream out(path);
+    if (!out)
+    {
+        return Acknowledgement::Failure;
+    }
+
+    out << std::setprecision(6) << L"{\n    \"benchmarks\":\n    [\n";
+    for (std::size_t index = 0; index < this->results.size(); ++index)
+    {
+        const BenchmarkResult& result = this->results[index];
+
+        out << L"        {\"name\": ";
+        WriteJSONString(out, result.name);
+        out << L", \"operations\": " << result.operations
+            << L", \"nanosecondsPerOperation\": "
+            << result.nanosecondsPerOperation
+            << L", \"operationsPerSecond\": " << result.operationsPerSecond
+            << L", \"allocationsPerOperation\": "
+            << result.allocationsPerOperation
+            << L", \"bytesPerOperation\": " << result.bytesPerOperation;
+        if (!std::isnan(result.instructionsPerOperation))
+        {
+            out << L", \"instructionsPerOperation\": "
+                << result.instructionsPerOperation;
+        }
+        out << L'}' << (index + 1 < this->results.size() ? L"," : L"")
+            << L'\n';
+    }
+    out << L"    ]\n}\n";
+
+    return out ? Acknowledgement::Success : Acknowledgement::Failure;
+}
+
+/**
+ * @brief Pulls the number after "key": out of one line WriteJSON wrote
+ *
+ */
+static double ReadJSONNumber(const std::wstring& line, const std::wstring& key)
+{
+    const std::size_t found = line.find(L'"' + key + L"\": ");
+    if (found == std::wstring::npos)
+    {
+        return 0;
+    }
+    return std::wcstod(line.c_str() + found + key.size() + 4, nullptr);
+}
+
+Acknowledgement BenchmarkSuite::CompareTo(const std::string& path)
+const noexcept
+{
+    std::wifstream in(path);
+    if (!in)
+    {
+        return Acknowledgement::Failure;
+    }
+
+    // name -> (ns/op, allocs/op, instructions/op)
+    std::map<std::wstring, std::array<double, 3>> baseline;
+    std::wstring line;
+    const std::wstring nameKey = L"{\"name\": \"";
+    while (std::getline(in, line))
+    {
+        const std::size_t found = line.find(nameKey);
+        if (found == std::wstring::npos)
+        {
+            continue;
+        }
+
+        std::wstring name;
+        for
+        (
+            std::size_t index = found + nameKey.size();
+            index < line.size() && line[index] != L'"';
+            ++index
+        )
+        {
+            if (line[index] == L'\\')
+            {
+                ++index;
+            }
+            name += line[index];
+        }
+        baseline[name] =
+        {
+            ReadJSONNumber(line, L"nanosecondsPerOperation"),
+            ReadJSONNumber(line, L"allocationsPerOperation"),
+            ReadJSONNumber(line, L"instructionsPerOperation"),
+        };
+    }
+
+    std::wcout << L"\ncompared to " << path.c_str() << L":\n";
+    for (const BenchmarkResult& result : this->results)
+    {
+        const auto found = baseline.find(result.name);
+        std::wcout << std::left << std::setw(68) << result.name << std::right;
+        if (found == baseline.end())
+        {
+            std::wcout << L"       new\n";
+            continue;
+        }
+
+        const double change =
+            (result.nanosecondsPerOperation / found->second[0] - 1) * 100;
+        std::wcout << std::fixed << std::setprecision(1) << std::showpos
+                   << std::setw(9) << change << L'%' << std::noshowpos
+                   << std::setprecision(2) << L"  (" << found->second[0]
+                   << L" -> " << result.nanosecondsPerOperation << L" ns/op";
+        // a stray allocation somewhere in millions of operations is noise,
+        // a few per batch of 4096 is not
+        if
+        (
+            std::fabs(found->second[1] - result.allocationsPerOperation)
+            >= 0.001
+        )
+        {
+            std::wcout << std::setprecision(3) << L", " << found->second[1]
+                       << L" -> "
+                       << result.allocationsPerOperation << L" allocs/op";
+        }
+        // 0 means the baseline did not count them
+        if
+        (
+            found->second[2] != 0 &&
+            !std::isnan(result.instructionsPerOperation)
+        )
+        {
+            std::wcout << std::setprecision(1) << L", " << found->second[2]
+                       << L" -> " << result.instructionsPerOperation
+                       << L" instructions/op";
+        }
+        std::wcout << L")\n" << std::defaultfloat;
+    }
+
+    return Acknowledgement::Success;
+}
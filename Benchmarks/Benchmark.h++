@@ -0,0 +1,241 @@
+/**
+ * @file Benchmark.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief A tiny microbenchmark harness: timing, heap allocation counting and
+ * JSON output that can be diffed against a saved baseline
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef BenchmarkFile
+#define BenchmarkFile
+
+#include "../Source/Abstraction/FluidEngineMember.h++"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace FluidEngine
+{
+    namespace Benchmarking
+    {
+        /**
+         * @brief Every heap allocation made through operator new since the
+         * program started (Benchmark.c++ replaces the global operator new)
+         * @author Joshua Buchanan
+         * @return std::size_t
+         */
+        std::size_t AllocationCount() noexcept;
+
+        /**
+         * @brief Every byte asked for through operator new since the
+         * program started
+         * @author Joshua Buchanan
+         * @return std::size_t
+         */
+        std::size_t AllocatedBytes() noexcept;
+
+        /**
+         * @brief Whether InstructionCount counts anything (it needs Linux
+         * and a kernel that lets us at the hardware counters)
+         * @author Joshua Buchanan
+         * @return true if instructions are being counted
+         */
+        bool CountsInstructions() noexcept;
+
+        /**
+         * @brief Every instruction this thread retired in user space since
+         * the counter was first asked for, or 0 if !CountsInstructions()
+         * @author Joshua Buchanan
+         * @return std::uint64_t
+         */
+        std::uint64_t InstructionCount() noexcept;
+
+        /**
+         * @brief Makes the compiler believe value is used, so that the work
+         * producing it is not optimized away
+         * @author Joshua Buchanan
+         * @tparam Value
+         * @param value
+         */
+        template<typename Value>
+        inline void KeepAlive(const Value& value) noexcept
+        {
+            asm volatile("" : : "m"(value) : "memory");
+        }
+
+        /**
+         * @brief What one benchmark measured
+         * @author Joshua Buchanan
+         */
+        struct BenchmarkResult
+        {
+            std::wstring name;
+            std::size_t operations;
+            double nanosecondsPerOperation;
+            double operationsPerSecond;
+            double allocationsPerOperation;
+            double bytesPerOperation;
+            /**
+             * @brief NaN if instructions could not be counted
+             *
+             */
+            double instructionsPerOperation;
+        };
+
+        /**
+         * @brief Runs benchmarks, prints them as they finish and keeps the
+         * results for WriteJSON and CompareTo
+         * @details
+         * Every benchmark is first run with more and more operations until
+         * one run takes at least a sampling period; that many operations
+         * are then timed a few more times and the median is reported, which
+         * keeps one unlucky context switch from showing up in the numbers.
+         * @author Joshua Buchanan
+         */
+        class BenchmarkSuite
+        {
+        private:
+
+            std::vector<BenchmarkResult> results;
+
+            /**
+             * @brief How long one sample runs at least
+             *
+             */
+            static constexpr std::chrono::nanoseconds samplingPeriod =
+                std::chrono::milliseconds(20);
+
+            /**
+             * @brief How many samples the median is taken of
+             *
+             */
+            static constexpr std::size_t sampleCount = 5;
+
+            /**
+             * @brief Keeps and prints a result
+             * @author Joshua Buchanan
+             */
+            void Record(const BenchmarkResult& result) noexcept;
+
+        public:
+
+            /**
+             * @brief Times operation
+             * @author Joshua Buchanan
+             * @tparam Operation callable with the index (0, 1, 2...) of the
+             * operation it is doing, so that it can vary its input
+             * @param name how the benchmark shows up in the output; has to
+             * be unique for CompareTo to make sense
+             * @param operation does one operation per call
+             * @param elementsPerCall how many operations one call counts as
+             * (a batch kernel call over 4096 numbers is 4096 operations)
+             */
+            template<typename Operation>
+            void Run
+            (
+                const std::wstring& name,
+                Operation operation,
+                const std::size_t& elementsPerCall = 1
+            ) noexcept
+            {
+                using Clock = std::chrono::steady_clock;
+
+                const auto time = [&operation](const std::size_t& calls)
+                {
+                    const auto start = Clock::now();
+                    for (std::size_t index = 0; index < calls; ++index)
+                    {
+                        operation(index);
+                    }
+                    return Clock::now() - start;
+                };
+
+                std::size_t calls = 1;
+                while (time(calls) < samplingPeriod)
+                {
+                    calls *= 2;
+                }
+
+                const std::size_t allocations = AllocationCount();
+                const std::size_t bytes = AllocatedBytes();
+                const std::uint64_t instructions = InstructionCount();
+                double samples[sampleCount];
+                for (double& sample : samples)
+                {
+                    sample = (double)std::chrono::nanoseconds
+                    (
+                        time(calls)
+                    ).count();
+                }
+                const std::uint64_t retired =
+                    InstructionCount() - instructions;
+                std::sort(samples, samples + sampleCount);
+
+                const double operations =
+                    (double)(calls * elementsPerCall);
+                const double nanoseconds =
+                    samples[sampleCount / 2] / operations;
+
+                this->Record
+                (
+                    {
+                        name,
+                        calls * elementsPerCall,
+                        nanoseconds,
+                        1e9 / nanoseconds,
+                        (AllocationCount() - allocations) /
+                            (operations * sampleCount),
+                        (AllocatedBytes() - bytes) /
+                            (operations * sampleCount),
+                        CountsInstructions() ?
+                            retired / (operations * sampleCount) :
+                            std::numeric_limits<double>::quiet_NaN(),
+                    }
+                );
+            }
+
+            /**
+             * @brief Everything measured so far
+             * @author Joshua Buchanan
+             * @return const std::vector<BenchmarkResult>&
+             */
+            const std::vector<BenchmarkResult>& GetResults() const noexcept;
+
+            /**
+             * @brief Writes the results as JSON, one benchmark per line
+             * @author Joshua Buchanan
+             * @param path where to write them
+             * @return Abstraction::Acknowledgement Failure if the file could
+             * not be written
+             */
+            Abstraction::Acknowledgement WriteJSON(const std::string& path)
+            const noexcept;
+
+            /**
+             * @brief Prints how every benchmark changed compared to a JSON
+             * file WriteJSON wrote earlier
+             * @author Joshua Buchanan
+             * @param path the baseline
+             * @return Abstraction::Acknowledgement Failure if there is no
+             * baseline to read
+             */
+            Abstraction::Acknowledgement CompareTo(const std::string& path)
+            const noexcept;
+        };
+
+    } // namespace Benchmarking
+
+} // namespace FluidEngine
+
+
+#endif
@@ -0,0 +1,810 @@
+/**
+ * @file BenchmarkMain.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Microbenchmarks for the Mathematics, Abstraction, Concurrency and
+ * Serialization layers
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ * @note Run through `make bench`. Usage:
+ * bench.out [where to write the JSON results [baseline JSON to compare to]]
+ */
+
+#include "Benchmark.h++"
+
+#include "../Source/Abstraction/FluidEngineMember.h++"
+#include "../Source/Concurrency/JobSystem.h++"
+#include "../Source/Mathematics/BatchKernels.h++"
+#include "../Source/Mathematics/FastInverseSquareRoots.h++"
+#include "../Source/Mathematics/SpatialGrid.h++"
+#include "../Source/Mathematics/Tensor.h++"
+#include "../Source/Mathematics/VectorBatch.h++"
+#include "../Source/Serialization/Snapshot.h++"
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace FluidEngine::Benchmarking;
+
+/**
+ * @brief How many different inputs every benchmark cycles through (a power
+ * of 2, so that picking one is a mask)
+ *
+ */
+static constexpr std::size_t inputCount = 1024;
+
+/**
+ * @brief How many numbers one batch kernel call gets
+ *
+ */
+static constexpr std::size_t batchSize = 4096;
+
+/**
+ * @brief How a precision shows up in benchmark names
+ *
+ */
+template<typename Floating>
+static std::wstring PrecisionName()
+{
+    if (std::is_same<Floating, float>::value)
+    {
+        return L"float";
+    }
+    if (std::is_same<Floating, double>::value)
+    {
+        return L"double";
+    }
+    return L"long double";
+}
+
+/**
+ * @brief inputCount random numbers in [low, high)
+ *
+ */
+template<typename Floating>
+static std::vector<Floating> RandomNumbers(Floating low, Floating high)
+{
+    std::mt19937 generator(1939344);
+    std::uniform_real_distribution<Floating> distribution(low, high);
+
+    std::vector<Floating> numbers(inputCount);
+    for (Floating& number : numbers)
+    {
+        number = distribution(generator);
+    }
+    return numbers;
+}
+
+/**
+ * @brief Constructing VectorBases, converting their precision, AsPolar vs
+ * AsPolarFast and NormalizedForm vs FastNormalize
+ *
+ */
+template<typename Floating>
+void BenchmarkVectorBase(BenchmarkSuite& suite)
+{
+    using namespace FluidEngine::Mathematics;
+    using FluidEngine::Abstraction::NameHandle;
+    using FluidEngine::Abstraction::NameTable;
+
+    const std::wstring prefix = L"VectorBase<" + PrecisionName<Floating>()
+                                + L"> ";
+    const std::vector<Floating> numbers = RandomNumbers<Floating>(-100, 100);
+    const auto number = [&numbers](const std::size_t& index)
+    {
+        return numbers[index % inputCount];
+    };
+
+    suite.Run(prefix + L"construct, std::wstring name",
+        [&](const std::size_t& index)
+        {
+            const VectorBase<Floating> vector
+            (
+                L"Benchmarked Vector", VectorDimensions::D3,
+                VectorFormatting::Rct,
+                number(index), number(index + 1), number(index + 2)
+            );
+            KeepAlive(vector);
+        });
+
+    const NameHandle handle = NameTable::Intern(L"Benchmarked Vector");
+    suite.Run(prefix + L"construct, NameHandle",
+        [&](const std::size_t& index)
+        {
+            const VectorBase<Floating> vector
+            (
+                handle, VectorDimensions::D3, VectorFormatting::Rct,
+                number(index), number(index + 1), number(index + 2)
+            );
+            KeepAlive(vector);
+        });
+
+    suite.Run(prefix + L"construct, unnamed",
+        [&](const std::size_t& index)
+        {
+            const VectorBase<Floating> vector
+            (
+                VectorDimensions::D3, VectorFormatting::Rct,
+                number(index), number(index + 1), number(index + 2)
+            );
+            KeepAlive(vector);
+        });
+
+    std::vector<VectorBase<Floating>> vectors;
+    for (std::size_t index = 0; index < inputCount; ++index)
+    {
+        vectors.push_back
+        (
+            VectorBase<Floating>::Generate3DRVectorWithOutName
+            (
+                number(index), number(index + 1), number(index + 2)
+            )
+        );
+    }
+    const auto vector = [&vectors](const std::size_t& index)
+        -> const VectorBase<Floating>&
+    {
+        return vectors[index % inputCount];
+    };
+
+    suite.Run(prefix + L"ConvertLowPrecision",
+        [&](const std::size_t& index)
+        {
+            KeepAlive(vector(index).ConvertLowPrecision());
+        });
+    suite.Run(prefix + L"ConvertMidPrecision",
+        [&](const std::size_t& index)
+        {
+            KeepAlive(vector(index).ConvertMidPrecision());
+        });
+    suite.Run(prefix + L"ConvertMaxPrecision",
+        [&](const std::size_t& index)
+        {
+            KeepAlive(vector(index).ConvertMaxPrecision());
+        });
+
+    suite.Run(prefix + L"AsPolar",
+        [&](const std::size_t& index)
+        {
+            KeepAlive(vector(index).AsPolar());
+        });
+    suite.Run(prefix + L"AsPolarFast",
+        [&](const std::size_t& index)
+        {
+            KeepAlive(vector(index).AsPolarFast());
+        });
+
+    suite.Run(prefix + L"NormalizedForm",
+        [&](const std::size_t& index)
+        {
+            KeepAlive(vector(index).NormalizedForm());
+        });
+    suite.Run(prefix + L"FastNormalize",
+        [&](const std::size_t& index)
+        {
+            KeepAlive(vector(index).FastNormalize());
+        });
+}
+
+/**
+ * @brief Integrator-like expressions evaluated lazily (one pass, no
+ * temporaries) against one operation at a time (a named VectorBase or a
+ * whole VectorBatch per operation)
+ *
+ */
+template<typename Floating>
+void BenchmarkVectorExpressions(BenchmarkSuite& suite)
+{
+    using namespace FluidEngine::Mathematics;
+
+    const std::wstring base = L"VectorBase<" + PrecisionName<Floating>()
+                              + L"> ";
+    const std::wstring batched = L"VectorBatch<" + PrecisionName<Floating>()
+                                 + L"> ";
+    const std::vector<Floating> numbers = RandomNumbers<Floating>(-100, 100);
+    const Floating dt = 0.01;
+
+    std::vector<VectorBase<Floating>> vectors;
+    VectorBatch<Floating> positions(VectorDimensions::D3,
+        VectorFormatting::Rct);
+    VectorBatch<Floating> velocities(VectorDimensions::D3,
+        VectorFormatting::Rct);
+    for (std::size_t index = 0; index < batchSize; ++index)
+    {
+        const VectorBase<Floating> vector =
+            VectorBase<Floating>::Generate3DRVectorWithOutName
+            (
+                numbers[index % inputCount],
+                numbers[(index + 1) % inputCount],
+                numbers[(index + 2) % inputCount]
+            );
+        vectors.push_back(vector);
+        positions.Import(vector);
+    }
+    for (std::size_t index = 0; index < batchSize; ++index)
+    {
+        velocities.Import(vectors[(index + 7) % batchSize]);
+    }
+    const VectorBatch<Floating> normals = positions.NormalizedForm();
+    const auto vector = [&vectors](const std::size_t& index)
+        -> const VectorBase<Floating>&
+    {
+        return vectors[index % inputCount];
+    };
+
+    suite.Run(base + L"x + v * dt, lazy",
+        [&](const std::size_t& index)
+        {
+            const VectorBase<Floating> next =
+                vector(index) + vector(index + 1) * dt;
+            KeepAlive(next);
+        });
+    suite.Run(base + L"x + v * dt, step by step",
+        [&](const std::size_t& index)
+        {
+            const VectorBase<Floating> scaled = vector(index + 1) * dt;
+            const VectorBase<Floating> next = vector(index) + scaled;
+            KeepAlive(next);
+        });
+
+    suite.Run(base + L"a + b * c - d.Reflection(n), lazy",
+        [&](const std::size_t& index)
+        {
+            const VectorBase<Floating> result = vector(index) +
+                vector(index + 1) * vector(index + 2) -
+                vector(index + 3).Reflection(vector(index + 4));
+            KeepAlive(result);
+        });
+    suite.Run(base + L"a + b * c - d.Reflection(n), step by step",
+        [&](const std::size_t& index)
+        {
+            const VectorBase<Floating> product =
+                vector(index + 1) * vector(index + 2);
+            const VectorBase<Floating> sum = vector(index) + product;
+            const VectorBase<Floating> reflected =
+                vector(index + 3).Reflection(vector(index + 4));
+            const VectorBase<Floating> result = sum - reflected;
+            KeepAlive(result);
+        });
+
+    suite.Run(batched + L"x = x + v * dt, lazy",
+        [&](const std::size_t&)
+        {
+            positions = positions + velocities * dt;
+            KeepAlive(positions.GetColumn(0).front());
+        },
+        batchSize);
+    suite.Run(batched + L"x + v * dt, step by step",
+        [&](const std::size_t&)
+        {
+            const VectorBatch<Floating> scaled = velocities * dt;
+            const VectorBatch<Floating> next = positions + scaled;
+            KeepAlive(next.GetColumn(0).front());
+        },
+        batchSize);
+
+    VectorBatch<Floating> result(VectorDimensions::D3, VectorFormatting::Rct);
+    suite.Run(batched + L"a + b * c - d.Reflection(n), lazy",
+        [&](const std::size_t&)
+        {
+            result = normals + velocities * normals -
+                velocities.Reflection(normals);
+            KeepAlive(result.GetColumn(0).front());
+        },
+        batchSize);
+    suite.Run(batched + L"a + b * c - d.Reflection(n), step by step",
+        [&](const std::size_t&)
+        {
+            const VectorBatch<Floating> product = velocities * normals;
+            const VectorBatch<Floating> sum = normals + product;
+            const VectorBatch<Floating> reflected =
+                velocities.Reflection(normals);
+            const VectorBatch<Floating> difference = sum - reflected;
+            KeepAlive(difference.GetColumn(0).front());
+        },
+        batchSize);
+}
+
+/**
+ * @brief FastInverseSquareRoot one at a time and in batches, against plain
+ * 1 / sqrt
+ *
+ */
+template<typename Floating>
+void BenchmarkFastInverseSquareRoot(BenchmarkSuite& suite)
+{
+    using namespace FluidEngine::Mathematics;
+
+    const std::wstring suffix = L"<" + PrecisionName<Floating>() + L">";
+    const std::vector<Floating> numbers = RandomNumbers<Floating>(0.01, 1e4);
+
+    suite.Run(L"1 / std::sqrt" + suffix,
+        [&](const std::size_t& index)
+        {
+            KeepAlive(1 / std::sqrt(numbers[index % inputCount]));
+        });
+    suite.Run(L"FastInverseSquareRoot" + suffix,
+        [&](const std::size_t& index)
+        {
+            KeepAlive(FastInverseSquareRoot(numbers[index % inputCount]));
+        });
+
+    std::vector<Floating> batch(batchSize);
+    std::vector<Floating> results(batchSize);
+    for (std::size_t index = 0; index < batchSize; ++index)
+    {
+        batch[index] = numbers[index % inputCount];
+    }
+    suite.Run(L"BatchKernels::FastInverseSquareRoot" + suffix,
+        [&](const std::size_t&)
+        {
+            BatchKernels::FastInverseSquareRoot<Floating>(batch, results);
+            KeepAlive(results.front());
+        },
+        batchSize);
+}
+
+/**
+ * @brief Constructing, copying and assigning FluidEngineMembers
+ *
+ */
+void BenchmarkFluidEngineMember(BenchmarkSuite& suite)
+{
+    using namespace FluidEngine::Abstraction;
+
+    const std::wstring name = L"Benchmarked Member";
+    const NameHandle handle = NameTable::Intern(name);
+    const FluidEngineMember original(handle);
+
+    suite.Run(L"FluidEngineMember construct, std::wstring name",
+        [&](const std::size_t&)
+        {
+            const FluidEngineMember member(name);
+            KeepAlive(member);
+        });
+    suite.Run(L"FluidEngineMember construct, NameHandle",
+        [&](const std::size_t&)
+        {
+            const FluidEngineMember member(handle);
+            KeepAlive(member);
+        });
+    suite.Run(L"FluidEngineMember copy construct",
+        [&](const std::size_t&)
+        {
+            const FluidEngineMember member(original);
+            KeepAlive(member);
+        });
+
+    FluidEngineMember assigned;
+    suite.Run(L"FluidEngineMember copy assign",
+        [&](const std::size_t&)
+        {
+            assigned = original;
+            KeepAlive(assigned);
+        });
+
+    // there is no move assignment, so this also pays for a copy assignment
+    FluidEngineMember moving(handle);
+    suite.Run(L"FluidEngineMember move construct + assign back",
+        [&](const std::size_t&)
+        {
+            FluidEngineMember member(std::move(moving));
+            KeepAlive(member);
+            moving = member;
+        });
+}
+
+/**
+ * @brief Bulk VectorBase work spread over 1, 2, 4... threads, up to one per
+ * core, and how much faster than 1 thread that gets
+ *
+ */
+void BenchmarkConcurrency(BenchmarkSuite& suite)
+{
+    using namespace FluidEngine::Mathematics;
+    using namespace FluidEngine::Concurrency;
+
+    // big enough that every thread gets plenty of grains
+    const std::size_t bulkSize = 64 * batchSize;
+    const std::size_t grain = 1024;
+    const std::vector<double> numbers = RandomNumbers<double>(-100, 100);
+
+    std::vector<VectorBase<double>> vectors;
+    for (std::size_t index = 0; index < bulkSize; ++index)
+    {
+        vectors.push_back
+        (
+            VectorBase<double>::Generate3DRVectorWithOutName
+            (
+                numbers[index % inputCount],
+                numbers[(index + 1) % inputCount],
+                numbers[(index + 2) % inputCount]
+            )
+        );
+    }
+    std::vector<VectorBase<double>> results = vectors;
+    std::vector<VectorBase<float>> lowPrecision;
+    for (const auto& vector : vectors)
+    {
+        lowPrecision.push_back(vector.ConvertLowPrecision());
+    }
+
+    std::vector<std::size_t> threadCounts;
+    for (std::size_t threads = 1; threads < JobSystem::DefaultThreadCount();
+        threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(JobSystem::DefaultThreadCount());
+
+    const auto run = [&](const std::wstring& operation, auto function)
+    {
+        double single = 0;
+        for (const std::size_t& threads : threadCounts)
+        {
+            JobSystem system(threads);
+            suite.Run(L"ParallelFor " + operation + L", " +
+                std::to_wstring(threads) + L" thread(s)",
+                [&](const std::size_t&)
+                {
+                    system.ParallelFor({0, bulkSize}, grain, function);
+                },
+                bulkSize);
+
+            const double nanoseconds =
+                suite.GetResults().back().nanosecondsPerOperation;
+            if (threads == 1)
+            {
+                single = nanoseconds;
+            }
+            std::wcout << L"    speedup over 1 thread: "
+                       << single / nanoseconds << L"x\n";
+        }
+    };
+
+    run(L"VectorBase<double> FastNormalize", [&](const Range& chunk)
+    {
+        for (std::size_t index = chunk.begin; index < chunk.end; ++index)
+        {
+            results[index] = vectors[index].FastNormalize();
+        }
+    });
+    run(L"VectorBase<double> AsPolarFast", [&](const Range& chunk)
+    {
+        for (std::size_t index = chunk.begin; index < chunk.end; ++index)
+        {
+            results[index] = vectors[index].AsPolarFast();
+        }
+    });
+    run(L"VectorBase<double> ConvertLowPrecision", [&](const Range& chunk)
+    {
+        for (std::size_t index = chunk.begin; index < chunk.end; ++index)
+        {
+            lowPrecision[index] = vectors[index].ConvertLowPrecision();
+        }
+    });
+}
+
+/**
+ * @brief Building a SpatialGrid over 10k to 1M particles and querying it,
+ * against looking at every particle with VectorBase's operator- and
+ * Magnitude
+ *
+ */
+void BenchmarkSpatialGrid(BenchmarkSuite& suite)
+{
+    using namespace FluidEngine::Mathematics;
+    using FluidEngine::Concurrency::JobSystem;
+
+    // one particle per unit of volume; a radius of 1.93 holds about 30
+    const double radius = 1.93;
+    const std::size_t queryCount = 1024;
+    JobSystem system;
+
+    for (const std::size_t count : {10000, 100000, 1000000})
+    {
+        const std::wstring particles =
+            L", " + std::to_wstring(count) + L" particles";
+        const double side = std::cbrt((double)count);
+        std::mt19937 generator(1939344);
+        std::uniform_real_distribution<double> distribution(0, side);
+
+        VectorBatch<double> positions
+        (
+            VectorDimensions::D3,
+            VectorFormatting::Rct,
+            count
+        );
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            for (double& coordinate : positions.GetColumn(axis))
+            {
+                coordinate = distribution(generator);
+            }
+        }
+        const std::vector<VectorBase<double>> vectors = positions.ExportAll();
+        std::vector<std::size_t> moved;
+        for (std::size_t index = 0; index < count; index += 100)
+        {
+            moved.push_back(index);
+        }
+
+        SpatialGrid<double> grid(L"Benchmark Grid", VectorDimensions::D3,
+            radius);
+        suite.Run(L"SpatialGrid<double> Build" + particles,
+            [&](const std::size_t&)
+            {
+                grid.Build(positions);
+            },
+            count);
+        const double serialBuild =
+            suite.GetResults().back().nanosecondsPerOperation * count;
+        suite.Run(L"SpatialGrid<double> Build, " +
+            std::to_wstring(system.ThreadCount()) + L" thread(s)" +
+            particles,
+            [&](const std::size_t&)
+            {
+                grid.Build(positions, system);
+            },
+            count);
+        // built with the moved ones stepped once, so the grid spans both
+        // places they go back and forth between and no Update rebuilds it
+        for (const std::size_t& index : moved)
+        {
+            positions.GetColumn(0)[index] += 0.01;
+        }
+        grid.Build(positions);
+        for (const std::size_t& index : moved)
+        {
+            positions.GetColumn(0)[index] -= 0.01;
+        }
+        suite.Run(L"SpatialGrid<double> Update, 1% moved" + particles,
+            [&](const std::size_t& call)
+            {
+                // back and forth, so positions stay where they were
+                const double step = call % 2 == 0 ? 0.01 : -0.01;
+                for (const std::size_t& index : moved)
+                {
+                    positions.GetColumn(0)[index] += step;
+                }
+                grid.Update(positions, moved);
+            },
+            moved.size());
+        std::wcout << L"    Update over a serial Build: "
+                   << suite.GetResults().back().nanosecondsPerOperation *
+                       moved.size() / serialBuild
+                   << L"\n";
+        grid.Build(positions);
+
+        std::vector<std::size_t> found;
+        suite.Run(L"SpatialGrid<double> FindNeighbors, r = 1.93" +
+            particles,
+            [&](const std::size_t& query)
+            {
+                grid.FindNeighbors
+                (
+                    vectors[query % queryCount].GetCoordinates(),
+                    radius,
+                    found
+                );
+                KeepAlive(found.data());
+            });
+        const double gridQuery =
+            suite.GetResults().back().nanosecondsPerOperation;
+        suite.Run(L"SpatialGrid<double> FindNearest, 8 nearest" + particles,
+            [&](const std::size_t& query)
+            {
+                grid.FindNearest
+                (
+                    vectors[query % queryCount].GetCoordinates(),
+                    8,
+                    found
+                );
+                KeepAlive(found.data());
+            });
+
+        suite.Run(L"neighbors by operator- and Magnitude, r = 1.93" +
+            particles,
+            [&](const std::size_t& query)
+            {
+                const VectorBase<double>& point = vectors[query % queryCount];
+                found.clear();
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    const VectorBase<double> difference =
+                        vectors[index] - point;
+                    if (difference.Magnitude() <= radius * radius)
+                    {
+                        found.push_back(index);
+                    }
+                }
+                KeepAlive(found.data());
+            });
+        std::wcout << L"    SpatialGrid speedup: "
+                   << suite.GetResults().back().nanosecondsPerOperation /
+                       gridQuery
+                   << L"x\n";
+    }
+}
+
+/**
+ * @brief Saving and loading a collection of VectorBases as text (through
+ * operator<< and std::wstringstream) and as a snapshot
+ *
+ */
+void BenchmarkSnapshots(BenchmarkSuite& suite)
+{
+    using namespace FluidEngine::Mathematics;
+    using namespace FluidEngine::Serialization;
+    using FluidEngine::Abstraction::Acknowledgement;
+
+    const std::size_t collectionSize = 64 * batchSize;
+    const std::string path = "BenchmarkSnapshot.fesnap";
+    const std::vector<double> numbers = RandomNumbers<double>(-100, 100);
+
+    std::vector<VectorBase<double>> vectors;
+    for (std::size_t index = 0; index < collectionSize; ++index)
+    {
+        vectors.push_back
+        (
+            VectorBase<double>::Generate3DRVectorWithName
+            (
+                L"Particle",
+                numbers[index % inputCount],
+                numbers[(index + 1) % inputCount],
+                numbers[(index + 2) % inputCount]
+            )
+        );
+    }
+
+    // the text path: one line per vector, every digit needed to load it back
+    const auto save = [&vectors]()
+    {
+        std::wstringstream text;
+        text.precision(std::numeric_limits<double>::max_digits10);
+        for (const VectorBase<double>& vector : vectors)
+        {
+            const auto& coordinates = vector.GetCoordinates();
+            text << vector.ToWString() << L' '
+                 << (int)vector.GetDimensions() << L' '
+                 << (int)vector.GetFormatting() << L' ' << coordinates[0]
+                 << L' ' << coordinates[1] << L' ' << coordinates[2] << L'\n';
+        }
+        return text.str();
+    };
+    const std::wstring text = save();
+
+    SnapshotWriter<double> writer(L"Benchmark Snapshot Writer");
+    const auto write = [&](const std::size_t& capacity)
+    {
+        writer.Open(path, capacity);
+        for (const VectorBase<double>& vector : vectors)
+        {
+            writer.Write(vector);
+        }
+        writer.Close();
+    };
+
+    suite.Run(L"save VectorBase<double>, text", [&](const std::size_t&)
+    {
+        KeepAlive(save());
+    }, collectionSize);
+    suite.Run(L"save VectorBase<double>, snapshot", [&](const std::size_t&)
+    {
+        write(vectors.size());
+    }, collectionSize);
+    // the columns move as they grow, and once more in Close
+    suite.Run(L"save VectorBase<double>, snapshot, no capacity given",
+        [&](const std::size_t&)
+        {
+            write(0);
+        }, collectionSize);
+
+    suite.Run(L"load VectorBase<double>, text", [&](const std::size_t&)
+    {
+        std::wistringstream lines(text);
+        std::vector<VectorBase<double>> loaded;
+        loaded.reserve(collectionSize);
+        std::wstring name;
+        std::wstring identification;
+        int dimensions;
+        int formatting;
+        double x;
+        double y;
+        double z;
+        while
+        (
+            lines >> name >> identification >> dimensions >> formatting >>
+                x >> y >> z
+        )
+        {
+            loaded.emplace_back
+            (
+                name,
+                (VectorDimensions)dimensions,
+                (VectorFormatting)formatting,
+                x,
+                y,
+                z
+            );
+        }
+        KeepAlive(loaded.data());
+    }, collectionSize);
+
+    SnapshotReader<double> reader(L"Benchmark Snapshot Reader");
+    suite.Run(L"load VectorBase<double>, snapshot, sum the columns",
+        [&](const std::size_t&)
+        {
+            reader.Open(path);
+            double sum = 0;
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                for (const double& coordinate : reader.GetColumn(axis))
+                {
+                    sum += coordinate;
+                }
+            }
+            KeepAlive(sum);
+        },
+        collectionSize);
+    suite.Run(L"load VectorBase<double>, snapshot, ExportAll",
+        [&](const std::size_t&)
+        {
+            reader.Open(path);
+            KeepAlive(reader.ExportAll().data());
+        },
+        collectionSize);
+
+    reader.Close();
+    std::remove(path.c_str());
+}
+
+int main(int argumentCount, char** arguments)
+{
+    using FluidEngine::Abstraction::Acknowledgement;
+
+    const std::string resultsPath =
+        argumentCount > 1 ? arguments[1] : "BenchmarkResults.json";
+
+    BenchmarkSuite suite;
+
+    BenchmarkVectorBase<float>(suite);
+    BenchmarkVectorBase<double>(suite);
+    BenchmarkVectorBase<long double>(suite);
+    BenchmarkVectorExpressions<float>(suite);
+    BenchmarkVectorExpressions<double>(suite);
+    BenchmarkVectorExpressions<long double>(suite);
+    BenchmarkFastInverseSquareRoot<float>(suite);
+    BenchmarkFastInverseSquareRoot<double>(suite);
+    BenchmarkFastInverseSquareRoot<long double>(suite);
+    BenchmarkFluidEngineMember(suite);
+    BenchmarkConcurrency(suite);
+    BenchmarkSpatialGrid(suite);
+    BenchmarkSnapshots(suite);
+
+    if (suite.WriteJSON(resultsPath) == Acknowledgement::Failure)
+    {
+        std::wcout << L"could not write " << resultsPath.c_str() << '\n';
+        return 1;
+    }
+    std::wcout << L"results written to " << resultsPath.c_str() << '\n';
+
+    if
+    (
+        argumentCount > 2 &&
+        suite.CompareTo(arguments[2]) == Acknowledgement::Failure
+    )
+    {
+        std::wcout << L"no baseline at " << arguments[2]
+                   << L" (save a results file there to compare against)\n";
+    }
+}
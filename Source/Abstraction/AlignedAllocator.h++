@@ -0,0 +1,120 @@
+/**
+ * @file AlignedAllocator.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Allocator that hands out over-aligned memory for SIMD columns
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef AlignedAllocatorFile
+#define AlignedAllocatorFile
+
+#include <cstddef>
+#include <new>
+
+namespace FluidEngine
+{
+    namespace Abstraction
+    {
+        /**
+         * @brief Alignment of the columns in batch containers. One cache
+         * line, which is also enough for any AVX load.
+         *
+         */
+        inline constexpr std::size_t ColumnAlignment = 64;
+
+        /**
+         * @brief std::allocator look-alike whose memory is aligned to
+         * Alignment bytes
+         * @author Joshua Buchanan
+         * @tparam Contained the allocated type
+         * @tparam Alignment alignment in bytes (power of two)
+         */
+        template<typename Contained, std::size_t Alignment = ColumnAlignment>
+        class AlignedAllocator
+        {
+        public:
+            using value_type = Contained;
+
+            /**
+             * @brief Lets std::vector and friends rebind to other types
+             *
+             * @tparam Other
+             */
+            template<typename Other>
+            struct rebind
+            {
+                using other = AlignedAllocator<Other, Alignment>;
+            };
+
+            constexpr AlignedAllocator() noexcept = default;
+
+            /**
+             * @brief Construct a new Aligned Allocator object from one of
+             * another type (allocators are stateless)
+             *
+             * @tparam Other
+             */
+            template<typename Other>
+            constexpr AlignedAllocator
+            (
+                const AlignedAllocator<Other, Alignment>&
+            ) noexcept
+            {
+                /*left blank*/
+            }
+
+            /**
+             * @brief Allocates count Containeds
+             * @note throws std::bad_alloc like every other allocator
+             * @param count
+             * @return Contained*
+             */
+            [[nodiscard]] Contained* allocate(std::size_t count)
+            {
+                return static_cast<Contained*>
+                (
+                    ::operator new
+                    (
+                        count * sizeof(Contained),
+                        std::align_val_t(Alignment)
+                    )
+                );
+            }
+
+            /**
+             * @brief Gives back memory from allocate
+             *
+             * @param pointer
+             */
+            void deallocate(Contained* pointer, std::size_t) noexcept
+            {
+                ::operator delete(pointer, std::align_val_t(Alignment));
+            }
+
+            /**
+             * @brief All AlignedAllocators with the same alignment are
+             * interchangeable
+             *
+             * @tparam Other
+             * @return true
+             */
+            template<typename Other>
+            constexpr bool operator==
+            (
+                const AlignedAllocator<Other, Alignment>&
+            ) const noexcept
+            {
+                return true;
+            }
+        };
+
+    } // namespace Abstraction
+
+} // namespace FluidEngine
+
+
+#endif
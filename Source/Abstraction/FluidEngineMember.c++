@@ -12,38 +12,82 @@
 
 #include "FluidEngineMember.h++"
 
-#include <sstream>
-//#define DEBUG
+#include "../Diagnostics/Instrumentation.h++"
 
-#ifdef DEBUG
-#include <iostream>
-#endif
+#include <sstream>
 
 using namespace FluidEngine::Abstraction;
 
+/**
+ * @brief The name members get when nobody names them
+ * 
+ * @return const NameHandle& 
+ */
+static const NameHandle& UnnamedMember() noexcept
+{
+    static const NameHandle unnamed = NameTable::Intern(L"Unnamed Member");
+    return unnamed;
+}
+
+/**
+ * @brief Construct a new Fluid Engine Member:: Fluid Engine Member object
+ * 
+ * @param referenceName handle of the reference name to use
+ */
+FluidEngineMember::FluidEngineMember(const NameHandle& referenceName) noexcept
+{
+    FluidEngineCount(MembersConstructed);
+    this->referenceName = referenceName;
+    this->identificationNumber = IssueIdentificationNumber();
+}
+
 /**
  * @brief Construct a new Fluid Engine Member:: Fluid Engine Member object
  * 
  * @param referenceName reference name to use
  */
 FluidEngineMember::FluidEngineMember(const std::wstring& referenceName) noexcept
+: FluidEngineMember(NameTable::Intern(referenceName))
 {
-#ifdef DEBUG
-    std::wcout << "Beginning creation of new FluidEngineMember" << '\n';
-#endif
-    this->referenceName = referenceName;
-#ifdef DEBUG
-    std::wcout << "Reference name set to " << referenceName << ". Its size is " << sizeof(referenceName) << '\n';
-#endif
-    // by setting identification number to point to itself, we guarantee that
-    // FluidEngineMembers will not have the same ID number--I Hope
-    this->identificationNumber = (std::ptrdiff_t)&(this->referenceName);
-#ifdef DEBUG
-    std::wcout << "Because identification number points to" << (std::ptrdiff_t)&(this->referenceName)
-    << ", this FluidEngineMember's identification number is " << this->identificationNumber << '\n';
-#endif
+    /*left blank*/
+}
+
+/**
+ * @brief Construct a new, unnamed Fluid Engine Member:: Fluid Engine Member
+ * object
+ * 
+ */
+FluidEngineMember::FluidEngineMember() noexcept
+: FluidEngineMember(UnnamedMember())
+{
+    /*left blank*/
 }
 
+/**
+ * @brief Copies a Fluid Engine Member. The copy is a new member, so it gets
+ * a new identification number.
+ * 
+ * @param other 
+ */
+FluidEngineMember::FluidEngineMember(const FluidEngineMember& other) noexcept
+: FluidEngineMember(other.referenceName)
+{
+    /*left blank*/
+}
+
+/**
+ * @brief Moves a Fluid Engine Member. The identification number moves along;
+ * other gets a fresh one so that no two members share a number.
+ * 
+ * @param other 
+ */
+FluidEngineMember::FluidEngineMember(FluidEngineMember&& other) noexcept
+{
+    FluidEngineCount(MembersConstructed);
+    this->referenceName = other.referenceName;
+    this->identificationNumber = other.identificationNumber;
+    other.identificationNumber = IssueIdentificationNumber();
+}
 
 /**
  * @brief Gets the reference name
@@ -54,7 +98,7 @@ const std::wstring&
 FluidEngineMember::GetReferenceName()
 const noexcept
 {
-    return this->referenceName;
+    return NameTable::Lookup(this->referenceName);
 }
 /**
  * @brief Gets the reference name
@@ -64,6 +108,29 @@ const noexcept
 const std::wstring&
 FluidEngineMember::GetReferenceName()
 noexcept
+{
+    return NameTable::Lookup(this->referenceName);
+}
+
+/**
+ * @brief Gets the handle of the reference name
+ * 
+ * @return const NameHandle& 
+ */
+const NameHandle&
+FluidEngineMember::GetNameHandle()
+const noexcept
+{
+    return this->referenceName;
+}
+/**
+ * @brief Gets the handle of the reference name
+ * 
+ * @return const NameHandle& 
+ */
+const NameHandle&
+FluidEngineMember::GetNameHandle()
+noexcept
 {
     return this->referenceName;
 }
@@ -79,15 +146,30 @@ FluidEngineMember::PutReferenceName
 (const std::wstring& referenceName)
 noexcept
 {
-    return this->referenceName = referenceName;
+    return this->PutReferenceName(NameTable::Intern(referenceName));
+}
+
+/**
+ * @brief Changes reference name
+ * 
+ * @param referenceName handle of the new name
+ * @return const std::wstring& 
+ */
+const std::wstring&
+FluidEngineMember::PutReferenceName
+(const NameHandle& referenceName)
+noexcept
+{
+    this->referenceName = referenceName;
+    return NameTable::Lookup(referenceName);
 }
 
 /**
  * @brief Gets the identification number
  * 
- * @return const std::ptrdiff_t&
+ * @return const IdentificationNumber&
  */
-const std::ptrdiff_t&
+const IdentificationNumber&
 FluidEngineMember::GetIdentificationNumber()
 const noexcept
 {
@@ -96,9 +178,9 @@ const noexcept
 /**
  * @brief Gets the identification number
  * 
- * @return const std::ptrdiff_t& 
+ * @return const IdentificationNumber& 
  */
-const std::ptrdiff_t&
+const IdentificationNumber&
 FluidEngineMember::GetIdentificationNumber()
 noexcept
 {
@@ -106,8 +188,8 @@ noexcept
 }
 
 /**
- * @brief Overriden assignment constructor to ensure that the identification number
- * updates for the new value.
+ * @brief Overriden assignment operator to ensure that the identification
+ * number stays the same; only the name is taken from other.
  * 
  * @param other 
  * @return const FluidEngineMember& 
@@ -116,12 +198,9 @@ const FluidEngineMember&
 FluidEngineMember::operator=
 (const FluidEngineMember& other) noexcept
 {
-#ifdef DEBUG
-    std::wcout << L"Assigning to " << this->identificationNumber << "\n";
-#endif
+    FluidEngineCount(MembersAssigned);
     // don't change our id
-    this->PutReferenceName(other.GetReferenceName());
-    this->identificationNumber = (std::ptrdiff_t)&(this->identificationNumber);
+    this->referenceName = other.referenceName;
     return FluidEngineMember::GetThisData(this);
 }
 
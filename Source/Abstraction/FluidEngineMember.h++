@@ -14,6 +14,7 @@
 
 // ik, ik, mutual inclusion ...
 #include "../Concepts/Concepts.h++"
+#include "Identity.h++"
 
 #include <cstddef>
 #include <exception>
@@ -30,14 +31,21 @@ namespace FluidEngine
          * FluidEngineMember should be only a base class. While it is not entirely
          * virtual, it uses a virtual destructor and a virtual assignment operator. 
          * 
-         * FluidEngineMembers all have a unique identification number. The genius 
-         * powering this unique identification number algorithm is that if all the
-         * identification algorithms are unique, they must currently point to 
-         * unique locations in memory, thus, they will have different values when
-         * they store their own memory address (Big Brain). 
+         * FluidEngineMembers all have a unique identification number, issued
+         * by IssueIdentificationNumber when the member is constructed. Unlike
+         * a memory address, it is not reused when a member is destroyed, only
+         * once the 32 bit counter wraps (see IssueIdentificationNumber), and
+         * it stays with the member:
+         * assigning to a member keeps its number, and moving a member moves
+         * its number along (the moved-from member gets a fresh one). Copying
+         * a member makes a new member, so the copy gets a new number.
+         * 
+         * The reference name lives in the NameTable; a member only holds a
+         * 4 byte handle to it, so copying a member (or any VectorBase math
+         * that passes the name along) never allocates.
          * 
          * FluidEngineMember explicitly implements the copy-assignment operator 
-         * to force the updating of the identification number.
+         * to keep the identification number as it is.
          * 
          * Where I know it's allowed, FluidEngineMember marks all of its functions
          * noexcept. This code contains no throw statements and relies on parts of 
@@ -46,8 +54,8 @@ namespace FluidEngine
         class FluidEngineMember
         {
         private:
-            std::wstring referenceName;
-            std::ptrdiff_t identificationNumber;
+            NameHandle referenceName;
+            IdentificationNumber identificationNumber;
 
         public:
             /**
@@ -64,17 +72,26 @@ namespace FluidEngine
                 return *that;
             }
 
-            FluidEngineMember(const std::wstring& = L"Unnamed Member") noexcept;
+            FluidEngineMember() noexcept;
+            FluidEngineMember(const std::wstring&) noexcept;
+            explicit FluidEngineMember(const NameHandle&) noexcept;
+
+            FluidEngineMember(const FluidEngineMember&) noexcept;
+            FluidEngineMember(FluidEngineMember&&) noexcept;
 
             virtual ~FluidEngineMember() noexcept = default;
 
             const std::wstring& GetReferenceName() const noexcept;
             const std::wstring& GetReferenceName() noexcept;
 
-            const std::ptrdiff_t& GetIdentificationNumber() const noexcept;
-            const std::ptrdiff_t& GetIdentificationNumber() noexcept;
+            const NameHandle& GetNameHandle() const noexcept;
+            const NameHandle& GetNameHandle() noexcept;
+
+            const IdentificationNumber& GetIdentificationNumber() const noexcept;
+            const IdentificationNumber& GetIdentificationNumber() noexcept;
 
             const std::wstring& PutReferenceName(const std::wstring&) noexcept;
+            const std::wstring& PutReferenceName(const NameHandle&) noexcept;
 
             /**
              * @brief Allows sending a FluidEngineMember to an outputstream-like
@@ -142,7 +159,7 @@ namespace FluidEngine
              * @param name name of this Shelled Value
              * @param assigningValue value to assign to
              */
-            template<Concepts::NothrowAssigningTo AssigningType>
+            template<Concepts::NothrowAssigningTo<ContainedType> AssigningType>
             Shell(const std::wstring& name, AssigningType assigningValue)
             noexcept
             : FluidEngineMember(name)
@@ -157,7 +174,7 @@ namespace FluidEngine
              * @param name name of this Shelled Value
              * @param assigningValue value to assign to
              */
-            template<Concepts::NothrowAssigningTo AssigningType>
+            template<Concepts::NothrowAssigningTo<ContainedType> AssigningType>
             Shell(AssigningType assigningValue)
             noexcept
             : FluidEngineMember(L"Unnamed Shelled Member")
@@ -232,7 +249,7 @@ namespace FluidEngine
              * @tparam NextType 
              * @return NextType 
              */
-            template<Concepts::NothrowConversionInto NextType>
+            template<Concepts::NothrowConversionInto<ContainedType> NextType>
             explicit operator NextType() noexcept
             {
                 return (NextType)(this->containedValue);
@@ -244,7 +261,7 @@ namespace FluidEngine
              * @tparam NextType 
              * @return Shell<NextType> 
              */
-            template<Concepts::NothrowConversionInto NextType>
+            template<Concepts::NothrowConversionInto<ContainedType> NextType>
             operator Shell<NextType>() noexcept
             {
                 return Shell(this->GetReferenceName(), (NextType)this->containedValue);
@@ -257,7 +274,7 @@ namespace FluidEngine
              * @param assigning 
              * @return Shell<ContainedType>& 
              */
-            template<Concepts::NothrowAssigningTo Assigning>
+            template<Concepts::NothrowAssigningTo<ContainedType> Assigning>
             Shell<ContainedType>& operator=(const Assigning& assigning) noexcept
             {
                 this->containedValue = (ContainedType)assigning;
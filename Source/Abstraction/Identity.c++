@@ -0,0 +1,115 @@
+/**
+ * @file Identity.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for Identity.h++
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "Identity.h++"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+using namespace FluidEngine::Abstraction;
+
+/**
+ * @brief What NameTable keeps behind the scenes
+ * @note Function-local static so that members constructed during static
+ * initialization of other files can use it.
+ */
+struct NameTableStorage
+{
+    std::shared_mutex mutex;
+    // deque, so that pushing a name never moves the other ones
+    std::deque<std::wstring> names;
+    // keys point into names
+    std::unordered_map<std::wstring_view, NameHandle> handles;
+
+    static NameTableStorage& Get() noexcept
+    {
+        static NameTableStorage storage;
+        return storage;
+    }
+};
+
+NameHandle NameTable::Intern(const std::wstring& name) noexcept
+{
+    NameTableStorage& storage = NameTableStorage::Get();
+
+    {
+        std::shared_lock<std::shared_mutex> lock(storage.mutex);
+        const auto found = storage.handles.find(name);
+        if (found != storage.handles.end())
+        {
+            return found->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(storage.mutex);
+    // somebody may have added it while we were not holding the lock
+    const auto found = storage.handles.find(name);
+    if (found != storage.handles.end())
+    {
+        return found->second;
+    }
+
+    const NameHandle handle = (NameHandle)storage.names.size();
+    storage.names.push_back(name);
+    storage.handles.emplace(storage.names.back(), handle);
+    return handle;
+}
+
+const std::wstring& NameTable::Lookup(const NameHandle& handle) noexcept
+{
+    NameTableStorage& storage = NameTableStorage::Get();
+
+    std::shared_lock<std::shared_mutex> lock(storage.mutex);
+    return storage.names[(std::size_t)handle];
+}
+
+std::size_t NameTable::Size() noexcept
+{
+    NameTableStorage& storage = NameTableStorage::Get();
+
+    std::shared_lock<std::shared_mutex> lock(storage.mutex);
+    return storage.names.size();
+}
+
+/**
+ * @brief How many numbers a thread takes at once
+ *
+ */
+static constexpr IdentificationNumber identificationBlockSize = 1024;
+
+/**
+ * @brief Start of the next block nobody has taken yet
+ *
+ */
+static std::atomic<IdentificationNumber> nextIdentificationBlock = 0;
+
+IdentificationNumber FluidEngine::Abstraction::IssueIdentificationNumber()
+noexcept
+{
+    thread_local IdentificationNumber next = 0;
+    thread_local IdentificationNumber blockEnd = 0;
+
+    if (next == blockEnd)
+    {
+        next = nextIdentificationBlock.fetch_add
+        (
+            identificationBlockSize,
+            std::memory_order_relaxed
+        );
+        blockEnd = next + identificationBlockSize;
+    }
+
+    return next++;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file Identity.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the name table and the identification numbers that
+ * FluidEngineMembers use
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef IdentityFile
+#define IdentityFile
+
+#include <cstdint>
+#include <string>
+
+namespace FluidEngine
+{
+    namespace Abstraction
+    {
+        /**
+         * @brief Handle to a name in the NameTable. Copying one is copying
+         * 4 bytes, no matter how long the name is.
+         *
+         */
+        enum class NameHandle : std::uint32_t {};
+
+        /**
+         * @brief The identification number of a FluidEngineMember
+         *
+         */
+        using IdentificationNumber = std::uint32_t;
+
+        /**
+         * @brief Global table of every reference name in use
+         * @details
+         * Every distinct name is stored exactly once and never removed, so
+         * a NameHandle stays valid (and the std::wstring it refers to stays
+         * put in memory) for the whole run. Interning a name that is already
+         * in the table does not allocate.
+         *
+         * Everything in here is safe to call from multiple threads.
+         * @author Joshua Buchanan
+         */
+        class NameTable
+        {
+        public:
+            NameTable() = delete;
+
+            /**
+             * @brief Gets the handle of a name, adding the name to the table
+             * if it is not there yet
+             * @author Joshua Buchanan
+             * @param name
+             * @return NameHandle
+             */
+            static NameHandle Intern(const std::wstring& name) noexcept;
+
+            /**
+             * @brief Gets the name behind a handle
+             * @author Joshua Buchanan
+             * @param handle a handle Intern returned
+             * @return const std::wstring& valid for the rest of the run
+             */
+            static const std::wstring& Lookup(const NameHandle& handle)
+            noexcept;
+
+            /**
+             * @brief How many distinct names there are
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            static std::size_t Size() noexcept;
+        };
+
+        /**
+         * @brief Hands out the next identification number.
+         * @details
+         * Each thread grabs a block of numbers from a shared atomic counter
+         * and then issues from that block without touching shared state, so
+         * numbers are unique across threads and increasing within a thread.
+         * @note 32 bits run out after 2^32 numbers have been issued; the
+         * counter then wraps to 0 and numbers are issued again, so a number
+         * is only unique among members made since the last wrap. Nothing
+         * checks whether an old member still holds a reissued number.
+         * @author Joshua Buchanan
+         * @return IdentificationNumber
+         */
+        IdentificationNumber IssueIdentificationNumber() noexcept;
+
+    } // namespace Abstraction
+
+} // namespace FluidEngine
+
+
+#endif
@@ -14,7 +14,12 @@
 
 
 
-#define DEBUG
-#undef DEBUG 
+/**
+ * @brief Builds the zones and counters of Diagnostics/Instrumentation.h++ in.
+ * Without it they compile to nothing. Uncomment it, or pass
+ * -DFluidEngineInstrumentation (make test and make bench-instrumented do).
+ *
+ */
+//#define FluidEngineInstrumentation
 
 #endif
\ No newline at end of file
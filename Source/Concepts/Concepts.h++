@@ -13,6 +13,7 @@
 #define ConceptsFile
 
 #include <ostream>
+#include <type_traits>
 
 namespace FluidEngine
 {
@@ -40,8 +41,7 @@ namespace FluidEngine
          * @tparam AssigningValue 
          * @tparam ContainedValue 
          */
-        template<typename AssigningValue>
-        template<typename ContainedValue>
+        template<typename AssigningValue, typename ContainedValue>
         concept NothrowAssigningTo = requires(ContainedValue contained, AssigningValue assigning)
         {
             noexcept(contained = assigning);
@@ -64,8 +64,7 @@ namespace FluidEngine
          * @tparam ConversionInto 
          * @tparam ConversionFrom 
          */
-        template<typename ConversionInto>
-        template<typename ConversionFrom>
+        template<typename ConversionInto, typename ConversionFrom>
         concept NothrowConversionInto = requires(ConversionFrom from, ConversionInto into)
         {
             noexcept((ConversionInto)from);
@@ -88,11 +87,10 @@ namespace FluidEngine
             /**
              * @brief Checks if lhs and rhs are addable
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept Addable = requires(LHSType lhs, RHSType rhs)
             {
                 lhs + rhs;
@@ -100,11 +98,10 @@ namespace FluidEngine
             /**
              * @brief Checks if lhs and rhs are subtractable
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept Subtractable = requires(LHSType lhs, RHSType rhs)
             {
                 lhs - rhs;
@@ -113,11 +110,10 @@ namespace FluidEngine
             /**
              * @brief Checks if lhs and rhs are multiplicable
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept Multiplicable = requires(LHSType lhs, RHSType rhs)
             {
                 lhs * rhs;
@@ -127,11 +123,10 @@ namespace FluidEngine
             /**
              * @brief checks if lhs / rhs works
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept Divisable = requires(LHSType lhs, RHSType rhs)
             {
                 lhs / rhs;
@@ -140,11 +135,10 @@ namespace FluidEngine
             /**
              * @brief Checks if lhs % rhs works
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept Moduluable = requires(LHSType lhs, RHSType rhs)
             {
                 lhs % rhs;
@@ -154,11 +148,10 @@ namespace FluidEngine
             /**
              * @brief Checks if lhs and rhs do not throw when added
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept NothrowAddable = requires(LHSType lhs, RHSType rhs)
             {
                 noexcept(lhs + rhs);
@@ -167,11 +160,10 @@ namespace FluidEngine
             /**
              * @brief Checks if lhs and rhs are subtractable without ever failing
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept NothrowSubtractable = requires(LHSType lhs, RHSType rhs)
             {
                 lhs - rhs;
@@ -180,11 +172,10 @@ namespace FluidEngine
             /**
              * @brief Checks if lhs and rhs are multiplicable without ever failing
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept NothrowMultiplicable = requires(LHSType lhs, RHSType rhs)
             {
                 lhs * rhs;
@@ -194,11 +185,10 @@ namespace FluidEngine
             /**
              * @brief checks if lhs / rhs works without ever failing
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept NothrowDivisable = requires(LHSType lhs, RHSType rhs)
             {
                 lhs / rhs;
@@ -207,11 +197,10 @@ namespace FluidEngine
             /**
              * @brief Checks if lhs % rhs works without ever failing
              * 
-             * @tparam RHSType 
              * @tparam LHSType 
+             * @tparam RHSType 
              */
-            template<typename RHSType>
-            template<typename LHSType>
+            template<typename LHSType, typename RHSType>
             concept NothrowModuluable = requires(LHSType lhs, RHSType rhs)
             {
                 lhs % rhs;
@@ -0,0 +1,230 @@
+/**
+ * @file JobSystem.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for JobSystem.h++
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "JobSystem.h++"
+
+using namespace FluidEngine::Concurrency;
+
+/**
+ * @brief The JobSystem the calling thread is a worker of (nullptr if none)
+ *
+ */
+static thread_local const JobSystem* currentSystem = nullptr;
+
+/**
+ * @brief Which worker of currentSystem the calling thread is
+ *
+ */
+static thread_local std::size_t currentWorker = 0;
+
+/**
+ * @brief How many times an idle worker looks for jobs before it sleeps;
+ * jobs tend to come in bursts, and waking up costs a system call
+ *
+ */
+static constexpr std::size_t spinsBeforeSleeping = 64;
+
+/**
+ * @brief Constructs a JobSystem and starts its workers
+ * @author Joshua Buchanan
+ * @param systemName handle of the name of the system
+ * @param threadCount how many threads work on jobs, counting the one
+ * waiting for them (at least 1)
+ */
+JobSystem::JobSystem
+(
+    const Abstraction::NameHandle& systemName,
+    const std::size_t& threadCount
+) noexcept
+: Abstraction::FluidEngineMember(systemName),
+  threadCount(threadCount ? threadCount : 1),
+  injectedCount(0),
+  signal(0),
+  stopping(false)
+{
+    for (std::size_t index = 0; index + 1 < this->threadCount; ++index)
+    {
+        this->workers.push_back(std::make_unique<Worker>());
+    }
+    // only once every deque exists: workers steal from each other
+    for (std::size_t index = 0; index < this->workers.size(); ++index)
+    {
+        this->workers[index]->thread = std::thread
+        (
+            [this, index]()
+            {
+                this->Work(index);
+            }
+        );
+    }
+}
+
+/**
+ * @brief Constructs a JobSystem and starts its workers
+ * @author Joshua Buchanan
+ * @param systemName the name of the system
+ * @param threadCount how many threads work on jobs, counting the one
+ * waiting for them (at least 1)
+ */
+JobSystem::JobSystem
+(
+    const std::wstring& systemName,
+    const std::size_t& threadCount
+) noexcept
+: JobSystem(Abstraction::NameTable::Intern(systemName), threadCount)
+{
+    /*Intentionally left blank*/
+}
+
+/**
+ * @brief Constructs a JobSystem and starts its workers
+ * @author Joshua Buchanan
+ * @param threadCount how many threads work on jobs, counting the one
+ * waiting for them (at least 1)
+ */
+JobSystem::JobSystem(const std::size_t& threadCount) noexcept
+: JobSystem(L"Unnamed Job System", threadCount)
+{
+    /*Intentionally left blank*/
+}
+
+JobSystem::~JobSystem() noexcept
+{
+    this->stopping.store(true, std::memory_order_release);
+    this->signal.fetch_add(1, std::memory_order_release);
+    this->signal.notify_all();
+
+    for (const auto& worker : this->workers)
+    {
+        worker->thread.join();
+    }
+}
+
+std::size_t JobSystem::DefaultThreadCount() noexcept
+{
+    const std::size_t cores = std::thread::hardware_concurrency();
+    return cores ? cores : 1;
+}
+
+std::size_t JobSystem::ThreadCount() const noexcept
+{
+    return this->threadCount;
+}
+
+void JobSystem::Submit(Job& job) noexcept
+{
+    if (currentSystem == this)
+    {
+        this->workers[currentWorker]->jobs.Push(&job);
+    }
+    else
+    {
+        const std::lock_guard<std::mutex> lock(this->injectedLock);
+        this->injected.push_back(&job);
+        this->injectedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    this->signal.fetch_add(1, std::memory_order_release);
+    this->signal.notify_one();
+}
+
+void JobSystem::WaitFor(const std::atomic<std::size_t>& pending) noexcept
+{
+    while (pending.load(std::memory_order_acquire) != 0)
+    {
+        Job* job = this->FindJob();
+        if (job != nullptr)
+        {
+            FluidEngineCount(JobsRun);
+            job->Execute(*this);
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+FluidEngine::Concurrency::Job* JobSystem::FindJob() noexcept
+{
+    Job* job = nullptr;
+    const bool isWorker = currentSystem == this;
+
+    if (isWorker && this->workers[currentWorker]->jobs.Pop(job))
+    {
+        return job;
+    }
+
+    if (this->injectedCount.load(std::memory_order_relaxed) != 0)
+    {
+        const std::lock_guard<std::mutex> lock(this->injectedLock);
+        if (!this->injected.empty())
+        {
+            job = this->injected.front();
+            this->injected.pop_front();
+            this->injectedCount.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    // start with the next worker over, so that thieves spread out
+    const std::size_t first = isWorker ? currentWorker + 1 : 0;
+    for (std::size_t offset = 0; offset < this->workers.size(); ++offset)
+    {
+        const std::size_t victim = (first + offset) % this->workers.size();
+        if (isWorker && victim == currentWorker)
+        {
+            continue;
+        }
+        if (this->workers[victim]->jobs.Steal(job))
+        {
+            FluidEngineCount(JobsStolen);
+            return job;
+        }
+    }
+
+    return nullptr;
+}
+
+void JobSystem::Work(const std::size_t& index) noexcept
+{
+    currentSystem = this;
+    currentWorker = index;
+
+    while (true)
+    {
+        // read before looking, so that a job submitted after the look
+        // changes it and keeps us from sleeping through it
+        const std::uint32_t seen = this->signal.load(std::memory_order_acquire);
+        if (this->stopping.load(std::memory_order_acquire))
+        {
+            return;
+        }
+
+        Job* job = this->FindJob();
+        for (std::size_t spin = 0; job == nullptr && spin < spinsBeforeSleeping;
+            ++spin)
+        {
+            std::this_thread::yield();
+            job = this->FindJob();
+        }
+
+        if (job != nullptr)
+        {
+            FluidEngineCount(JobsRun);
+            job->Execute(*this);
+        }
+        else
+        {
+            this->signal.wait(seen, std::memory_order_acquire);
+        }
+    }
+}
@@ -0,0 +1,413 @@
+/**
+ * @file JobSystem.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines JobSystem, a fixed pool of work-stealing worker threads,
+ * and ParallelFor / ParallelReduce on top of it
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef JobSystemFile
+#define JobSystemFile
+
+#include "WorkStealingDeque.h++"
+#include "../Abstraction/FluidEngineMember.h++"
+#include "../Diagnostics/Instrumentation.h++"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace FluidEngine
+{
+    namespace Concurrency
+    {
+        /**
+         * @brief The indices [begin, end)
+         * @author Joshua Buchanan
+         */
+        struct Range
+        {
+            std::size_t begin;
+            std::size_t end;
+        };
+
+        class JobSystem;
+
+        /**
+         * @brief Something a JobSystem can run
+         * @note Not a FluidEngineMember on purpose: there are thousands of
+         * these per frame, and none of them needs a name.
+         * @author Joshua Buchanan
+         */
+        class Job
+        {
+        public:
+            virtual ~Job() noexcept = default;
+
+            /**
+             * @brief Does the work. Runs on whichever thread got to the
+             * job first, and must not throw.
+             * @author Joshua Buchanan
+             * @param system the JobSystem running it, to submit more jobs to
+             */
+            virtual void Execute(JobSystem& system) noexcept = 0;
+        };
+
+        /**
+         * @brief A fixed pool of worker threads that share jobs by work
+         * stealing
+         * @details
+         * Every worker owns a WorkStealingDeque. Jobs submitted from a
+         * worker go to the bottom of its own deque, and it keeps taking
+         * from there (newest first, so the data is still in cache). A
+         * worker that runs dry steals the oldest job of another worker,
+         * which for ParallelFor is the biggest piece of work left. Jobs
+         * submitted from any other thread go to a shared queue.
+         *
+         * Threads waiting for jobs to finish (WaitFor, ParallelFor...) run
+         * jobs themselves while they wait, so a job may wait for jobs of
+         * its own without ever blocking a worker.
+         *
+         * Results never depend on the thread count: ParallelFor splits a
+         * range into the same chunks whatever the number of threads, and
+         * ParallelReduce combines chunk results in chunk order.
+         * @author Joshua Buchanan
+         */
+        class JobSystem : public Abstraction::FluidEngineMember
+        {
+        private:
+
+            /**
+             * @brief One worker thread and its jobs
+             *
+             */
+            struct Worker
+            {
+                WorkStealingDeque<Job*> jobs;
+                std::thread thread;
+            };
+
+            std::size_t threadCount;
+            std::vector<std::unique_ptr<Worker>> workers;
+
+            /**
+             * @brief Jobs submitted from threads that are not workers
+             *
+             */
+            std::mutex injectedLock;
+            std::deque<Job*> injected;
+            std::atomic<std::size_t> injectedCount;
+
+            /**
+             * @brief Bumped whenever there is something new to do; sleeping
+             * workers wait on it to change
+             *
+             */
+            std::atomic<std::uint32_t> signal;
+            std::atomic<bool> stopping;
+
+            /**
+             * @brief Everything a worker thread does
+             *
+             * @param index which worker
+             */
+            void Work(const std::size_t& index) noexcept;
+
+            /**
+             * @brief Finds a job for the calling thread: its own newest
+             * job, else a submitted one, else one stolen from another worker
+             *
+             * @return Job* nullptr if there is nothing to do
+             */
+            Job* FindJob() noexcept;
+
+            template<typename Function>
+            struct ForState;
+
+            /**
+             * @brief A piece of a ParallelFor: the chunks [first, last)
+             * @details Until it runs out of job slots, it gives the upper
+             * half of its chunks to a new job (so idle workers can steal
+             * it) and keeps the lower half, then runs what is left.
+             *
+             * @tparam Function
+             */
+            template<typename Function>
+            class ForJob : public Job
+            {
+            public:
+                ForState<Function>* state;
+                std::size_t first;
+                std::size_t last;
+
+                void Execute(JobSystem& system) noexcept override
+                {
+                    FluidEngineZone("ParallelFor job");
+                    ForState<Function>& state = *this->state;
+
+                    while (this->last - this->first > 1)
+                    {
+                        const std::size_t slot = state.nextJob.fetch_add
+                        (
+                            1,
+                            std::memory_order_relaxed
+                        );
+                        if (slot >= state.jobs.size())
+                        {
+                            break;
+                        }
+
+                        const std::size_t middle =
+                            this->first + (this->last - this->first) / 2;
+                        ForJob<Function>& upper = state.jobs[slot];
+                        upper.state = &state;
+                        upper.first = middle;
+                        upper.last = this->last;
+                        this->last = middle;
+
+                        state.pending.fetch_add(1, std::memory_order_relaxed);
+                        system.Submit(upper);
+                    }
+
+                    for (std::size_t chunk = this->first; chunk < this->last;
+                        ++chunk)
+                    {
+                        state.function(state.Chunk(chunk));
+                    }
+
+                    // the last thing touching state: the waiting thread may
+                    // destroy it as soon as this reaches 0
+                    state.pending.fetch_sub(1, std::memory_order_release);
+                }
+            };
+
+            /**
+             * @brief What the jobs of one ParallelFor share
+             *
+             * @tparam Function
+             */
+            template<typename Function>
+            struct ForState
+            {
+                Range range;
+                std::size_t grain;
+                Function& function;
+                std::atomic<std::size_t> pending;
+                std::atomic<std::size_t> nextJob;
+                std::vector<ForJob<Function>> jobs;
+
+                Range Chunk(const std::size_t& chunk) const noexcept
+                {
+                    const std::size_t begin =
+                        this->range.begin + chunk * this->grain;
+                    return
+                    {
+                        begin,
+                        std::min(this->range.end, begin + this->grain)
+                    };
+                }
+            };
+
+        public:
+
+            /**
+             * @brief How many ParallelFor jobs there are at most per thread;
+             * more means better balancing but more overhead
+             *
+             */
+            static constexpr std::size_t jobsPerThread = 8;
+
+            JobSystem
+            (
+                const std::wstring&,
+                const std::size_t& = DefaultThreadCount()
+            ) noexcept;
+
+            JobSystem
+            (
+                const Abstraction::NameHandle&,
+                const std::size_t& = DefaultThreadCount()
+            ) noexcept;
+
+            explicit JobSystem(const std::size_t& = DefaultThreadCount())
+            noexcept;
+
+            JobSystem(const JobSystem&) = delete;
+            JobSystem& operator=(const JobSystem&) = delete;
+
+            /**
+             * @brief Stops and joins every worker
+             * @note Jobs still queued are not run; wait for them first.
+             * @author Joshua Buchanan
+             */
+            ~JobSystem() noexcept;
+
+            /**
+             * @brief One thread per core (or 1 if that is unknown)
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            static std::size_t DefaultThreadCount() noexcept;
+
+            /**
+             * @brief How many threads work on jobs: the workers, plus the
+             * thread waiting for them (a JobSystem of 1 thread has no
+             * workers and runs everything on the waiting thread)
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            std::size_t ThreadCount() const noexcept;
+
+            /**
+             * @brief Queues a job
+             * @note job has to stay alive until it has run; use a counter
+             * the job decrements and WaitFor to know when that is.
+             * @author Joshua Buchanan
+             * @param job
+             */
+            void Submit(Job& job) noexcept;
+
+            /**
+             * @brief Runs jobs until pending reaches 0
+             * @author Joshua Buchanan
+             * @param pending decremented (with release semantics) by the
+             * jobs being waited for
+             */
+            void WaitFor(const std::atomic<std::size_t>& pending) noexcept;
+
+            /**
+             * @brief Calls function for every chunk of range, in parallel
+             * @details
+             * The chunks are [begin, begin + grain), [begin + grain,
+             * begin + 2 grain)... (the last one may be shorter), whatever
+             * the thread count. Returns once every chunk is done.
+             * @author Joshua Buchanan
+             * @tparam Function callable with a Range; must not throw
+             * @param range the indices to go through
+             * @param grain how many indices one call gets (0 counts as 1)
+             * @param function
+             */
+            template<typename Function>
+            void ParallelFor
+            (
+                const Range& range,
+                const std::size_t& grain,
+                Function function
+            ) noexcept
+            {
+                if (range.end <= range.begin)
+                {
+                    return;
+                }
+                FluidEngineZone("JobSystem::ParallelFor");
+
+                const std::size_t step = grain ? grain : 1;
+                const std::size_t chunks =
+                    (range.end - range.begin - 1) / step + 1;
+
+                ForState<Function> state
+                {
+                    range,
+                    step,
+                    function,
+                    {1},
+                    {0},
+                    {}
+                };
+                if (this->threadCount > 1)
+                {
+                    state.jobs.resize
+                    (
+                        std::min(chunks, this->threadCount * jobsPerThread)
+                    );
+                }
+
+                ForJob<Function> root;
+                root.state = &state;
+                root.first = 0;
+                root.last = chunks;
+                root.Execute(*this);
+
+                this->WaitFor(state.pending);
+            }
+
+            /**
+             * @brief Maps every chunk of range to a value and combines them
+             * @details
+             * Chunks are the same as ParallelFor's, and their values are
+             * combined left to right in chunk order, so the result is the
+             * same for every thread count (even for floating point sums).
+             * @author Joshua Buchanan
+             * @tparam Value
+             * @tparam Map callable with a Range, returning a Value
+             * @tparam Combine callable with two Values, returning a Value
+             * @param range the indices to go through
+             * @param grain how many indices one chunk has (0 counts as 1)
+             * @param identity where combining starts
+             * @param map
+             * @param combine
+             * @return Value
+             */
+            template<typename Value, typename Map, typename Combine>
+            Value ParallelReduce
+            (
+                const Range& range,
+                const std::size_t& grain,
+                const Value& identity,
+                Map map,
+                Combine combine
+            ) noexcept
+            {
+                if (range.end <= range.begin)
+                {
+                    return identity;
+                }
+
+                // chunks write their partials from different threads, so
+                // a partial has to be its own object; std::vector<bool>
+                // would pack neighbours into one byte and race on it
+                struct Partial
+                {
+                    Value value;
+                };
+
+                const std::size_t step = grain ? grain : 1;
+                std::vector<Partial> partials
+                (
+                    (range.end - range.begin - 1) / step + 1,
+                    Partial{identity}
+                );
+
+                this->ParallelFor(range, step,
+                    [&](const Range& chunk)
+                    {
+                        partials[(chunk.begin - range.begin) / step].value =
+                            map(chunk);
+                    });
+
+                Value result = identity;
+                for (const Partial& partial : partials)
+                {
+                    result = combine(result, partial.value);
+                }
+                return result;
+            }
+        };
+
+    } // namespace Concurrency
+
+} // namespace FluidEngine
+
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * @file TaskGraph.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for TaskGraph.h++
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "TaskGraph.h++"
+
+#include <utility>
+
+using namespace FluidEngine::Concurrency;
+
+TaskGraph::Task::Task(TaskGraph* graph, std::function<void()> work) noexcept
+: graph(graph), work(std::move(work)), dependencies(0), remaining(0)
+{
+    /*Intentionally left blank*/
+}
+
+void TaskGraph::Task::Execute(JobSystem& system) noexcept
+{
+    {
+        FluidEngineZone("TaskGraph task");
+        this->work();
+    }
+
+    for (const TaskHandle& successor : this->successors)
+    {
+        Task& next = this->graph->tasks[successor];
+        // whoever finishes the last dependency starts it
+        if (next.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            system.Submit(next);
+        }
+    }
+
+    // the last thing touching the graph: Run may return once this hits 0
+    this->graph->pending.fetch_sub(1, std::memory_order_release);
+}
+
+/**
+ * @brief Construct a new, empty TaskGraph
+ * @author Joshua Buchanan
+ * @param graphName the name of the graph
+ */
+TaskGraph::TaskGraph(const std::wstring& graphName) noexcept
+: Abstraction::FluidEngineMember(graphName), pending(0)
+{
+    /*Intentionally left blank*/
+}
+
+/**
+ * @brief Construct a new, empty TaskGraph
+ * @author Joshua Buchanan
+ */
+TaskGraph::TaskGraph() noexcept
+: TaskGraph(L"Unnamed Task Graph")
+{
+    /*Intentionally left blank*/
+}
+
+TaskGraph::TaskHandle TaskGraph::Add(std::function<void()> work) noexcept
+{
+    this->tasks.emplace_back(this, std::move(work));
+    return this->tasks.size() - 1;
+}
+
+FluidEngine::Abstraction::Acknowledgement TaskGraph::Precede
+(
+    const TaskHandle& before,
+    const TaskHandle& after
+) noexcept
+{
+    if
+    (
+        before >= this->tasks.size() ||
+        after >= this->tasks.size() ||
+        before == after
+    )
+    {
+        return Abstraction::Acknowledgement::Failure;
+    }
+
+    this->tasks[before].successors.push_back(after);
+    ++this->tasks[after].dependencies;
+    return Abstraction::Acknowledgement::Success;
+}
+
+std::size_t TaskGraph::Size() const noexcept
+{
+    return this->tasks.size();
+}
+
+FluidEngine::Abstraction::Acknowledgement TaskGraph::Run(JobSystem& system)
+noexcept
+{
+    FluidEngineZone("TaskGraph::Run");
+
+    // Kahn's algorithm: if taking away tasks without dependencies left
+    // does not take away every task, the rest wait for each other
+    std::vector<std::size_t> dependencies(this->tasks.size());
+    std::vector<TaskHandle> ready;
+    for (TaskHandle task = 0; task < this->tasks.size(); ++task)
+    {
+        dependencies[task] = this->tasks[task].dependencies;
+        if (dependencies[task] == 0)
+        {
+            ready.push_back(task);
+        }
+    }
+    const std::vector<TaskHandle> roots = ready;
+
+    std::size_t ordered = 0;
+    while (!ready.empty())
+    {
+        const TaskHandle task = ready.back();
+        ready.pop_back();
+        ++ordered;
+        for (const TaskHandle& successor : this->tasks[task].successors)
+        {
+            if (--dependencies[successor] == 0)
+            {
+                ready.push_back(successor);
+            }
+        }
+    }
+    if (ordered != this->tasks.size())
+    {
+        return Abstraction::Acknowledgement::Failure;
+    }
+
+    for (Task& task : this->tasks)
+    {
+        task.remaining.store(task.dependencies, std::memory_order_relaxed);
+    }
+    this->pending.store(this->tasks.size(), std::memory_order_relaxed);
+
+    for (const TaskHandle& root : roots)
+    {
+        system.Submit(this->tasks[root]);
+    }
+    system.WaitFor(this->pending);
+    return Abstraction::Acknowledgement::Success;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file TaskGraph.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines TaskGraph, tasks with dependencies that run on a JobSystem
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef TaskGraphFile
+#define TaskGraphFile
+
+#include "JobSystem.h++"
+#include "../Abstraction/FluidEngineMember.h++"
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace FluidEngine
+{
+    namespace Concurrency
+    {
+        /**
+         * @brief Tasks, and which tasks have to finish before which
+         * @details
+         * Build the graph once (Add, Precede), then Run it as often as
+         * needed, e.g. once a frame. A task starts as soon as every task
+         * preceding it is done, so independent tasks run in parallel. Tasks
+         * may use ParallelFor on the JobSystem they are run on.
+         * @author Joshua Buchanan
+         */
+        class TaskGraph : public Abstraction::FluidEngineMember
+        {
+        public:
+
+            /**
+             * @brief Refers to a task of this graph
+             *
+             */
+            using TaskHandle = std::size_t;
+
+        private:
+
+            /**
+             * @brief One task, and the tasks waiting for it
+             *
+             */
+            class Task : public Job
+            {
+            public:
+                TaskGraph* graph;
+                std::function<void()> work;
+                std::vector<TaskHandle> successors;
+                std::size_t dependencies;
+                std::atomic<std::size_t> remaining;
+
+                Task(TaskGraph* graph, std::function<void()> work) noexcept;
+
+                void Execute(JobSystem& system) noexcept override;
+            };
+
+            // a deque, so that adding tasks never moves the old ones
+            std::deque<Task> tasks;
+
+            /**
+             * @brief How many tasks of the current Run are not done yet
+             *
+             */
+            std::atomic<std::size_t> pending;
+
+        public:
+
+            TaskGraph(const std::wstring&) noexcept;
+            TaskGraph() noexcept;
+
+            TaskGraph(const TaskGraph&) = delete;
+            TaskGraph& operator=(const TaskGraph&) = delete;
+
+            /**
+             * @brief Adds a task
+             * @author Joshua Buchanan
+             * @param work what the task does; must not throw
+             * @return TaskHandle
+             */
+            TaskHandle Add(std::function<void()> work) noexcept;
+
+            /**
+             * @brief Makes after wait for before
+             * @author Joshua Buchanan
+             * @param before
+             * @param after
+             * @return Abstraction::Acknowledgement Failure if either is not
+             * a task of this graph, or they are the same task
+             */
+            Abstraction::Acknowledgement Precede
+            (
+                const TaskHandle& before,
+                const TaskHandle& after
+            ) noexcept;
+
+            /**
+             * @brief How many tasks there are
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            std::size_t Size() const noexcept;
+
+            /**
+             * @brief Runs every task once, and returns when all are done
+             * @author Joshua Buchanan
+             * @param system the JobSystem to run them on
+             * @return Abstraction::Acknowledgement Failure (and nothing runs)
+             * if the tasks wait for each other in a cycle
+             */
+            Abstraction::Acknowledgement Run(JobSystem& system) noexcept;
+        };
+
+    } // namespace Concurrency
+
+} // namespace FluidEngine
+
+
+#endif
@@ -0,0 +1,269 @@
+/**
+ * @file WorkStealingDeque.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines WorkStealingDeque, the lock-free deque every worker of a
+ * JobSystem keeps its jobs in
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef WorkStealingDequeFile
+#define WorkStealingDequeFile
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace FluidEngine
+{
+    namespace Concurrency
+    {
+        /**
+         * @brief A Chase-Lev work-stealing deque
+         * @details
+         * One thread (the owner) pushes and pops at the bottom, like a
+         * stack; any other thread may steal from the top. Nothing ever
+         * takes a lock: the owner only synchronizes with thieves when
+         * the deque is down to its last item.
+         *
+         * The ring buffer doubles when it is full. Thieves may still be
+         * reading the old one, so old buffers are only freed when the deque
+         * is destroyed (they add up to less than the current one).
+         *
+         * Follows "Correct and Efficient Work-Stealing for Weak Memory
+         * Models" (Le, Pop, Cohen, Zappa Nardelli, 2013).
+         * @author Joshua Buchanan
+         * @tparam Item something small and trivially copyable (a pointer)
+         */
+        template<typename Item>
+        requires std::is_trivially_copyable<Item>::value
+        class WorkStealingDeque
+        {
+        private:
+
+            /**
+             * @brief A ring buffer whose capacity is a power of 2
+             *
+             */
+            struct Buffer
+            {
+                std::size_t capacity;
+                std::unique_ptr<std::atomic<Item>[]> items;
+
+                Buffer(const std::size_t& capacity) noexcept
+                : capacity(capacity),
+                  items(new std::atomic<Item>[capacity])
+                {
+                    /*Intentionally left blank*/
+                }
+
+                Item Get(const std::int64_t& index) const noexcept
+                {
+                    const std::size_t slot =
+                        (std::size_t)index & (this->capacity - 1);
+                    return this->items[slot].load(std::memory_order_relaxed);
+                }
+                void Put(const std::int64_t& index, const Item& item)
+                noexcept
+                {
+                    const std::size_t slot =
+                        (std::size_t)index & (this->capacity - 1);
+                    this->items[slot].store(item, std::memory_order_relaxed);
+                }
+            };
+
+            // top and bottom on their own cache lines: thieves hammer top,
+            // the owner hammers bottom
+            alignas(64) std::atomic<std::int64_t> top;
+            alignas(64) std::atomic<std::int64_t> bottom;
+            alignas(64) std::atomic<Buffer*> buffer;
+
+            /**
+             * @brief Every buffer this deque ever had (the last one is the
+             * current one). Only the owner touches this.
+             *
+             */
+            std::vector<std::unique_ptr<Buffer>> buffers;
+
+            /**
+             * @brief Moves everything into a buffer twice as big
+             *
+             * @return Buffer* the new buffer
+             */
+            Buffer* Grow
+            (
+                Buffer* old,
+                const std::int64_t& bottom,
+                const std::int64_t& top
+            ) noexcept
+            {
+                this->buffers.push_back
+                (
+                    std::make_unique<Buffer>(old->capacity * 2)
+                );
+                Buffer* grown = this->buffers.back().get();
+                for (std::int64_t index = top; index < bottom; ++index)
+                {
+                    grown->Put(index, old->Get(index));
+                }
+                this->buffer.store(grown, std::memory_order_release);
+                return grown;
+            }
+
+        public:
+
+            /**
+             * @brief Construct a new, empty WorkStealingDeque
+             * @author Joshua Buchanan
+             * @param capacity how many items fit before it has to grow
+             * (rounded up to a power of 2)
+             */
+            WorkStealingDeque(const std::size_t& capacity = 256) noexcept
+            : top(0), bottom(0)
+            {
+                std::size_t rounded = 1;
+                while (rounded < capacity)
+                {
+                    rounded *= 2;
+                }
+                this->buffers.push_back(std::make_unique<Buffer>(rounded));
+                this->buffer.store
+                (
+                    this->buffers.back().get(),
+                    std::memory_order_relaxed
+                );
+            }
+
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            /**
+             * @brief Adds an item at the bottom
+             * @note Owner only
+             * @author Joshua Buchanan
+             * @param item
+             */
+            void Push(const Item& item) noexcept
+            {
+                const std::int64_t bottom =
+                    this->bottom.load(std::memory_order_relaxed);
+                const std::int64_t top =
+                    this->top.load(std::memory_order_acquire);
+                Buffer* buffer = this->buffer.load(std::memory_order_relaxed);
+
+                if (bottom - top > (std::int64_t)buffer->capacity - 1)
+                {
+                    buffer = this->Grow(buffer, bottom, top);
+                }
+                buffer->Put(bottom, item);
+
+                // publishes the item (and whatever it points to) to thieves
+                this->bottom.store(bottom + 1, std::memory_order_release);
+            }
+
+            /**
+             * @brief Takes the item at the bottom (the one pushed last)
+             * @note Owner only
+             * @author Joshua Buchanan
+             * @param item where to put it
+             * @return true if there was one
+             */
+            bool Pop(Item& item) noexcept
+            {
+                const std::int64_t bottom =
+                    this->bottom.load(std::memory_order_relaxed) - 1;
+                Buffer* buffer = this->buffer.load(std::memory_order_relaxed);
+                this->bottom.store(bottom, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                std::int64_t top = this->top.load(std::memory_order_relaxed);
+
+                if (top > bottom)
+                {
+                    // empty
+                    this->bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return false;
+                }
+
+                item = buffer->Get(bottom);
+                if (top == bottom)
+                {
+                    // the last item, which a thief might be taking too
+                    const bool won = this->top.compare_exchange_strong
+                    (
+                        top,
+                        top + 1,
+                        std::memory_order_seq_cst,
+                        std::memory_order_relaxed
+                    );
+                    this->bottom.store(bottom + 1, std::memory_order_relaxed);
+                    return won;
+                }
+                return true;
+            }
+
+            /**
+             * @brief Takes the item at the top (the oldest one)
+             * @note Any thread
+             * @author Joshua Buchanan
+             * @param item where to put it
+             * @return true if there was one and nobody else got it first
+             */
+            bool Steal(Item& item) noexcept
+            {
+                std::int64_t top = this->top.load(std::memory_order_acquire);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                const std::int64_t bottom =
+                    this->bottom.load(std::memory_order_acquire);
+
+                if (top >= bottom)
+                {
+                    return false;
+                }
+
+                Buffer* buffer = this->buffer.load(std::memory_order_acquire);
+                const Item stolen = buffer->Get(top);
+                if
+                (
+                    !this->top.compare_exchange_strong
+                    (
+                        top,
+                        top + 1,
+                        std::memory_order_seq_cst,
+                        std::memory_order_relaxed
+                    )
+                )
+                {
+                    return false;
+                }
+                item = stolen;
+                return true;
+            }
+
+            /**
+             * @brief How many items are in here (only a snapshot when other
+             * threads are busy with it)
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            std::size_t Size() const noexcept
+            {
+                const std::int64_t bottom =
+                    this->bottom.load(std::memory_order_relaxed);
+                const std::int64_t top =
+                    this->top.load(std::memory_order_relaxed);
+                return bottom > top ? (std::size_t)(bottom - top) : 0;
+            }
+        };
+
+    } // namespace Concurrency
+
+} // namespace FluidEngine
+
+
+#endif
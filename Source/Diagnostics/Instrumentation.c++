@@ -0,0 +1,365 @@
+/**
+ * @file Instrumentation.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for Instrumentation.h++
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "Instrumentation.h++"
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace FluidEngine::Diagnostics;
+
+constinit thread_local ThreadRecord*
+    FluidEngine::Diagnostics::localRecord = nullptr;
+
+std::atomic<bool> FluidEngine::Diagnostics::recording(false);
+
+/**
+ * @brief Every ThreadRecord there is, and the lock to add to it with
+ * @author Joshua Buchanan
+ */
+struct Registry
+{
+    std::mutex lock;
+    std::vector<std::unique_ptr<ThreadRecord>> records;
+};
+
+/**
+ * @brief The Registry; never destroyed, since threads may still be
+ * recording while static objects are destroyed
+ * @author Joshua Buchanan
+ * @return Registry&
+ */
+static Registry& TheRegistry() noexcept
+{
+    static Registry* registry = new Registry();
+    return *registry;
+}
+
+/**
+ * @brief Gives the record of a thread back when the thread finishes
+ * @author Joshua Buchanan
+ */
+struct RecordLease
+{
+    ThreadRecord* record = nullptr;
+
+    ~RecordLease() noexcept
+    {
+        if (this->record != nullptr)
+        {
+            localRecord = nullptr;
+            this->record->inUse.store(false, std::memory_order_release);
+        }
+    }
+};
+
+static thread_local RecordLease lease;
+
+ThreadRecord& FluidEngine::Diagnostics::RegisterThread() noexcept
+{
+    Registry& registry = TheRegistry();
+    const std::lock_guard<std::mutex> lock(registry.lock);
+
+    ThreadRecord* found = nullptr;
+    for (const auto& record : registry.records)
+    {
+        if (!record->inUse.load(std::memory_order_acquire))
+        {
+            found = record.get();
+            break;
+        }
+    }
+    if (found == nullptr)
+    {
+        registry.records.push_back(std::make_unique<ThreadRecord>());
+        found = registry.records.back().get();
+        found->threadNumber = (std::uint32_t)registry.records.size();
+    }
+
+    found->inUse.store(true, std::memory_order_relaxed);
+    lease.record = found;
+    localRecord = found;
+    return *found;
+}
+
+const char* FluidEngine::Diagnostics::CounterName(const Counter& counter)
+noexcept
+{
+    switch (counter)
+    {
+    case Counter::MembersConstructed:
+        return "MembersConstructed";
+    case Counter::MembersAssigned:
+        return "MembersAssigned";
+    case Counter::VectorsNormalized:
+        return "VectorsNormalized";
+    case Counter::FastPathHits:
+        return "FastPathHits";
+    case Counter::ExactPathHits:
+        return "ExactPathHits";
+    case Counter::JobsRun:
+        return "JobsRun";
+    case Counter::JobsStolen:
+        return "JobsStolen";
+    case Counter::ZonesDropped:
+        return "ZonesDropped";
+    default:
+        return "Unknown";
+    }
+}
+
+std::uint64_t FluidEngine::Diagnostics::CounterTotal(const Counter& counter)
+noexcept
+{
+    if constexpr (!instrumentationEnabled)
+    {
+        return 0;
+    }
+
+    Registry& registry = TheRegistry();
+    const std::lock_guard<std::mutex> lock(registry.lock);
+
+    std::uint64_t total = 0;
+    for (const auto& record : registry.records)
+    {
+        total += record->counters[(std::size_t)counter].load
+        (
+            std::memory_order_relaxed
+        );
+    }
+    return total;
+}
+
+/**
+ * @brief Construct a new TraceWriter that is not running yet
+ * @author Joshua Buchanan
+ * @param writerName the name of the writer
+ */
+TraceWriter::TraceWriter(const std::wstring& writerName) noexcept
+: Abstraction::FluidEngineMember(writerName),
+  flushInterval(0),
+  epoch(0),
+  firstEvent(true),
+  stopping(false)
+{
+    /*Intentionally left blank*/
+}
+
+/**
+ * @brief Construct a new TraceWriter that is not running yet
+ * @author Joshua Buchanan
+ */
+TraceWriter::TraceWriter() noexcept
+: TraceWriter(L"Unnamed Trace Writer")
+{
+    /*Intentionally left blank*/
+}
+
+TraceWriter::~TraceWriter() noexcept
+{
+    this->Stop();
+}
+
+FluidEngine::Abstraction::Acknowledgement TraceWriter::Start
+(
+    const std::string& path,
+    const std::chrono::milliseconds& flushInterval
+) noexcept
+{
+    if constexpr (!instrumentationEnabled)
+    {
+        return Abstraction::Acknowledgement::Failure;
+    }
+
+    if (this->flusher.joinable())
+    {
+        return Abstraction::Acknowledgement::Failure;
+    }
+    bool wasRecording = false;
+    if
+    (
+        !recording.compare_exchange_strong
+        (
+            wasRecording,
+            true,
+            std::memory_order_acq_rel
+        )
+    )
+    {
+        // another TraceWriter is running
+        return Abstraction::Acknowledgement::Failure;
+    }
+
+    this->file.open(path, std::ios::out | std::ios::trunc);
+    if (!this->file)
+    {
+        recording.store(false, std::memory_order_release);
+        return Abstraction::Acknowledgement::Failure;
+    }
+
+    this->flushInterval = flushInterval;
+    this->epoch = Now();
+    this->firstEvent = true;
+    this->stopping = false;
+    this->file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+    // drop what an earlier trace left in the rings
+    {
+        Registry& registry = TheRegistry();
+        const std::lock_guard<std::mutex> lock(registry.lock);
+        for (const auto& record : registry.records)
+        {
+            record->zones.Drain([](const ZoneEvent&) {});
+        }
+    }
+
+    this->flusher = std::thread
+    (
+        [this]()
+        {
+            std::unique_lock<std::mutex> lock(this->stopLock);
+            while (!this->stopping)
+            {
+                this->stopSignal.wait_for(lock, this->flushInterval);
+                lock.unlock();
+                this->Flush();
+                lock.lock();
+            }
+        }
+    );
+    return Abstraction::Acknowledgement::Success;
+}
+
+FluidEngine::Abstraction::Acknowledgement TraceWriter::Stop() noexcept
+{
+    if (!this->flusher.joinable())
+    {
+        return Abstraction::Acknowledgement::Failure;
+    }
+
+    // zones still open when this happens end up in the next trace, and
+    // are thrown away when it starts
+    recording.store(false, std::memory_order_release);
+    {
+        const std::lock_guard<std::mutex> lock(this->stopLock);
+        this->stopping = true;
+    }
+    this->stopSignal.notify_one();
+    this->flusher.join();
+
+    this->Flush();
+    this->file << "\n]}\n";
+    this->file.close();
+    return Abstraction::Acknowledgement::Success;
+}
+
+void TraceWriter::WriteEvent(const std::string& text) noexcept
+{
+    if (!this->firstEvent)
+    {
+        this->file << ",\n";
+    }
+    this->firstEvent = false;
+    this->file << '{' << text << '}';
+}
+
+/**
+ * @brief Microseconds since epoch, as Chrome traces want them
+ * @author Joshua Buchanan
+ * @return std::string
+ */
+static std::string Microseconds
+(
+    const std::uint64_t& nanoseconds,
+    const std::uint64_t& epoch
+) noexcept
+{
+    const std::uint64_t since = nanoseconds > epoch ? nanoseconds - epoch : 0;
+    char text[32];
+    std::snprintf
+    (
+        text,
+        sizeof(text),
+        "%llu.%03llu",
+        (unsigned long long)(since / 1000),
+        (unsigned long long)(since % 1000)
+    );
+    return text;
+}
+
+/**
+ * @brief name, with what JSON does not allow in strings escaped
+ * @author Joshua Buchanan
+ * @return std::string
+ */
+static std::string Escaped(const char* name) noexcept
+{
+    std::string escaped;
+    for (; *name != '\0'; ++name)
+    {
+        if (*name == '"' || *name == '\\')
+        {
+            escaped += '\\';
+        }
+        if ((unsigned char)*name >= 0x20)
+        {
+            escaped += *name;
+        }
+    }
+    return escaped;
+}
+
+void TraceWriter::Flush() noexcept
+{
+    Registry& registry = TheRegistry();
+    const std::lock_guard<std::mutex> lock(registry.lock);
+
+    for (const auto& record : registry.records)
+    {
+        const std::string thread =
+            ",\"pid\":1,\"tid\":" + std::to_string(record->threadNumber);
+        record->zones.Drain
+        (
+            [&](const ZoneEvent& event)
+            {
+                this->WriteEvent
+                (
+                    "\"name\":\"" + Escaped(event.name) +
+                    "\",\"ph\":\"X\",\"ts\":" +
+                    Microseconds(event.start, this->epoch) +
+                    ",\"dur\":" + Microseconds(event.end, event.start) +
+                    thread
+                );
+            }
+        );
+    }
+
+    const std::string now = Microseconds(Now(), this->epoch);
+    for (std::size_t counter = 0; counter < counterCount; ++counter)
+    {
+        std::uint64_t total = 0;
+        for (const auto& record : registry.records)
+        {
+            total += record->counters[counter].load
+            (
+                std::memory_order_relaxed
+            );
+        }
+        this->WriteEvent
+        (
+            std::string("\"name\":\"") + CounterName((Counter)counter) +
+            "\",\"ph\":\"C\",\"ts\":" + now +
+            ",\"pid\":1,\"args\":{\"value\":" + std::to_string(total) + '}'
+        );
+    }
+    this->file.flush();
+}
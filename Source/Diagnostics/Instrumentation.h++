@@ -0,0 +1,454 @@
+/**
+ * @file Instrumentation.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines zones and counters for the hot paths, and TraceWriter,
+ * which writes them out as a Chrome trace
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ * @note Only built in when FluidEngineInstrumentation is defined (see
+ * Unification.h++). Otherwise FluidEngineZone and FluidEngineCount
+ * compile to nothing, and TraceWriter refuses to start.
+ */
+
+#ifndef InstrumentationFile
+#define InstrumentationFile
+
+#include "../Abstraction/FluidEngineMember.h++"
+#include "../Abstraction/Unification.h++"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace FluidEngine
+{
+    namespace Diagnostics
+    {
+        /**
+         * @brief Whether this build has instrumentation in it
+         *
+         */
+#ifdef FluidEngineInstrumentation
+        inline constexpr bool instrumentationEnabled = true;
+#else
+        inline constexpr bool instrumentationEnabled = false;
+#endif
+
+        /**
+         * @brief Everything FluidEngineCount counts
+         * @author Joshua Buchanan
+         */
+        enum class Counter : std::size_t
+        {
+            /**
+             * @brief FluidEngineMembers constructed (copies and moves too)
+             *
+             */
+            MembersConstructed,
+            /**
+             * @brief FluidEngineMembers assigned to
+             *
+             */
+            MembersAssigned,
+            /**
+             * @brief Rectangular vectors normalized, one at a time or in
+             * batches
+             *
+             */
+            VectorsNormalized,
+            /**
+             * @brief Normalizations that took the FastInverseSquareRoot path
+             *
+             */
+            FastPathHits,
+            /**
+             * @brief Normalizations that took the std::sqrt path
+             *
+             */
+            ExactPathHits,
+            /**
+             * @brief Jobs a JobSystem ran
+             *
+             */
+            JobsRun,
+            /**
+             * @brief Jobs a JobSystem thread took from another worker
+             *
+             */
+            JobsStolen,
+            /**
+             * @brief Zones that did not fit in their thread's ring and were
+             * left out of the trace
+             *
+             */
+            ZonesDropped,
+
+            Count
+        };
+
+        inline constexpr std::size_t counterCount =
+            (std::size_t)Counter::Count;
+
+        /**
+         * @brief How a counter shows up in traces
+         * @author Joshua Buchanan
+         * @param counter
+         * @return const char*
+         */
+        const char* CounterName(const Counter& counter) noexcept;
+
+        /**
+         * @brief What counter counted so far, over every thread
+         * @author Joshua Buchanan
+         * @param counter
+         * @return std::uint64_t 0 without instrumentation
+         */
+        std::uint64_t CounterTotal(const Counter& counter) noexcept;
+
+        /**
+         * @brief Nanoseconds on the steady clock
+         * @author Joshua Buchanan
+         * @return std::uint64_t
+         */
+        inline std::uint64_t Now() noexcept
+        {
+            return (std::uint64_t)std::chrono::duration_cast
+            <
+                std::chrono::nanoseconds
+            >(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /**
+         * @brief One finished zone
+         *
+         */
+        struct ZoneEvent
+        {
+            const char* name;
+            std::uint64_t start;
+            std::uint64_t end;
+        };
+
+        /**
+         * @brief A single producer, single consumer ring of ZoneEvents
+         * @details The thread the ring belongs to pushes, the TraceWriter
+         * drains. Neither ever waits for the other: when the ring is full,
+         * the event is dropped (and counted as dropped).
+         * @author Joshua Buchanan
+         */
+        class ZoneRing
+        {
+        public:
+
+            /**
+             * @brief How many zones fit between two flushes (a power of 2)
+             *
+             */
+            static constexpr std::size_t capacity = 4096;
+
+        private:
+
+            std::array<ZoneEvent, capacity> events;
+            alignas(64) std::atomic<std::uint64_t> head;
+            alignas(64) std::atomic<std::uint64_t> tail;
+
+        public:
+
+            ZoneRing() noexcept : head(0), tail(0)
+            {
+                /*Intentionally left blank*/
+            }
+
+            /**
+             * @brief Adds an event
+             * @note Owning thread only
+             * @author Joshua Buchanan
+             * @param event
+             * @return true if it fit
+             */
+            bool Push(const ZoneEvent& event) noexcept
+            {
+                const std::uint64_t head =
+                    this->head.load(std::memory_order_relaxed);
+                if (head - this->tail.load(std::memory_order_acquire) ==
+                    capacity)
+                {
+                    return false;
+                }
+                this->events[head & (capacity - 1)] = event;
+                this->head.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            /**
+             * @brief Hands every event in the ring to sink, oldest first,
+             * and empties it
+             * @note TraceWriter only
+             * @author Joshua Buchanan
+             * @tparam Sink callable with a const ZoneEvent&
+             * @param sink
+             */
+            template<typename Sink>
+            void Drain(Sink&& sink) noexcept
+            {
+                const std::uint64_t tail =
+                    this->tail.load(std::memory_order_relaxed);
+                const std::uint64_t head =
+                    this->head.load(std::memory_order_acquire);
+                for (std::uint64_t index = tail; index < head; ++index)
+                {
+                    sink(this->events[index & (capacity - 1)]);
+                }
+                this->tail.store(head, std::memory_order_release);
+            }
+        };
+
+        /**
+         * @brief What one thread recorded
+         * @details Only its own thread writes to it, so counting is a plain
+         * load and store, without a locked instruction. Records outlive
+         * their threads; a new thread reuses the record of a finished one.
+         * @author Joshua Buchanan
+         */
+        struct ThreadRecord
+        {
+            std::array<std::atomic<std::uint64_t>, counterCount> counters{};
+            ZoneRing zones;
+            std::uint32_t threadNumber = 0;
+            std::atomic<bool> inUse{false};
+        };
+
+        /**
+         * @brief The calling thread's record (nullptr until it records
+         * something)
+         *
+         */
+        extern constinit thread_local ThreadRecord* localRecord;
+
+        /**
+         * @brief Whether a TraceWriter is running, i.e. whether zones are
+         * recorded at all
+         *
+         */
+        extern std::atomic<bool> recording;
+
+        /**
+         * @brief Gives the calling thread a record
+         * @author Joshua Buchanan
+         * @return ThreadRecord&
+         */
+        ThreadRecord& RegisterThread() noexcept;
+
+        /**
+         * @brief The calling thread's record
+         * @author Joshua Buchanan
+         * @return ThreadRecord&
+         */
+        inline ThreadRecord& LocalRecord() noexcept
+        {
+            ThreadRecord* record = localRecord;
+            if (record == nullptr) [[unlikely]]
+            {
+                return RegisterThread();
+            }
+            return *record;
+        }
+
+        /**
+         * @brief Adds amount to counter, for the calling thread
+         * @note Use FluidEngineCount, which compiles to nothing when
+         * instrumentation is off
+         * @author Joshua Buchanan
+         * @param counter
+         * @param amount
+         */
+        inline void Count
+        (
+            const Counter& counter,
+            const std::uint64_t& amount = 1
+        ) noexcept
+        {
+            std::atomic<std::uint64_t>& total =
+                LocalRecord().counters[(std::size_t)counter];
+            total.store
+            (
+                total.load(std::memory_order_relaxed) + amount,
+                std::memory_order_relaxed
+            );
+        }
+
+        /**
+         * @brief Records the time between its construction and its
+         * destruction as a zone of the trace, if a trace is being written
+         * @note Use FluidEngineZone, which compiles to nothing when
+         * instrumentation is off
+         * @author Joshua Buchanan
+         */
+        class Zone
+        {
+        private:
+
+            const char* name;
+            std::uint64_t start;
+
+        public:
+
+            /**
+             * @brief Starts a zone
+             * @author Joshua Buchanan
+             * @param name how the zone shows up in the trace; has to live
+             * as long as the program (a string literal)
+             */
+            explicit Zone(const char* name) noexcept
+            : name(name),
+              start(recording.load(std::memory_order_relaxed) ? Now() : 0)
+            {
+                /*Intentionally left blank*/
+            }
+
+            Zone(const Zone&) = delete;
+            Zone& operator=(const Zone&) = delete;
+
+            ~Zone() noexcept
+            {
+                // 0 means nobody was recording when the zone started
+                if (this->start != 0)
+                {
+                    ThreadRecord& record = LocalRecord();
+                    if (!record.zones.Push({this->name, this->start, Now()}))
+                    {
+                        Count(Counter::ZonesDropped);
+                    }
+                }
+            }
+        };
+
+        /**
+         * @brief Writes zones and counters as a Chrome trace (the JSON that
+         * chrome://tracing and Perfetto open)
+         * @details
+         * A background thread drains every thread's ZoneRing into the file
+         * every flush interval, and adds a sample of every counter. Only
+         * one TraceWriter can be running at a time.
+         * @author Joshua Buchanan
+         */
+        class TraceWriter : public Abstraction::FluidEngineMember
+        {
+        private:
+
+            std::ofstream file;
+            std::chrono::milliseconds flushInterval;
+            std::uint64_t epoch;
+            bool firstEvent;
+
+            std::thread flusher;
+            std::mutex stopLock;
+            std::condition_variable stopSignal;
+            bool stopping;
+
+            /**
+             * @brief Writes out everything recorded since the last flush
+             *
+             */
+            void Flush() noexcept;
+
+            /**
+             * @brief Writes one event; text is its JSON without the braces
+             *
+             */
+            void WriteEvent(const std::string& text) noexcept;
+
+        public:
+
+            TraceWriter(const std::wstring&) noexcept;
+            TraceWriter() noexcept;
+
+            TraceWriter(const TraceWriter&) = delete;
+            TraceWriter& operator=(const TraceWriter&) = delete;
+
+            /**
+             * @brief Stops, if it is running
+             * @author Joshua Buchanan
+             */
+            ~TraceWriter() noexcept;
+
+            /**
+             * @brief Starts recording zones into a new trace file
+             * @author Joshua Buchanan
+             * @param path where to write the trace (overwritten)
+             * @param flushInterval how often the rings are drained; they
+             * hold ZoneRing::capacity zones per thread in between
+             * @return Abstraction::Acknowledgement Failure if
+             * instrumentation is not built in, a trace is already being
+             * written, or path cannot be written
+             */
+            Abstraction::Acknowledgement Start
+            (
+                const std::string& path,
+                const std::chrono::milliseconds& flushInterval =
+                    std::chrono::milliseconds(10)
+            ) noexcept;
+
+            /**
+             * @brief Stops recording, writes out what is left and closes the
+             * trace file
+             * @author Joshua Buchanan
+             * @return Abstraction::Acknowledgement Failure if it was not
+             * running
+             */
+            Abstraction::Acknowledgement Stop() noexcept;
+        };
+
+    } // namespace Diagnostics
+
+} // namespace FluidEngine
+
+#define FluidEngineJoinTokens(lhs, rhs) lhs##rhs
+#define FluidEngineJoin(lhs, rhs) FluidEngineJoinTokens(lhs, rhs)
+
+#ifdef FluidEngineInstrumentation
+/**
+ * @brief Records the rest of the enclosing scope as a zone called name
+ *
+ */
+#define FluidEngineZone(name) \
+    const ::FluidEngine::Diagnostics::Zone \
+        FluidEngineJoin(fluidEngineZone, __LINE__)(name)
+/**
+ * @brief Adds 1 to a Diagnostics::Counter, e.g.
+ * FluidEngineCount(MembersConstructed)
+ *
+ */
+#define FluidEngineCount(counter) \
+    ::FluidEngine::Diagnostics::Count \
+    ( \
+        ::FluidEngine::Diagnostics::Counter::counter \
+    )
+/**
+ * @brief Adds amount to a Diagnostics::Counter
+ *
+ */
+#define FluidEngineCountBy(counter, amount) \
+    ::FluidEngine::Diagnostics::Count \
+    ( \
+        ::FluidEngine::Diagnostics::Counter::counter, \
+        (amount) \
+    )
+#else
+#define FluidEngineZone(name) static_cast<void>(0)
+#define FluidEngineCount(counter) static_cast<void>(0)
+#define FluidEngineCountBy(counter, amount) static_cast<void>(0)
+#endif
+
+
+#endif
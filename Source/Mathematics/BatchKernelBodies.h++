@@ -0,0 +1,554 @@
+/**
+ * @file BatchKernelBodies.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief The loops behind BatchKernels, written once for every instruction
+ * set
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ * @note Only for BatchKernels.c++ and BatchKernelsAVX2.c++. Those are
+ * compiled with different target flags, which is why nothing in here calls
+ * into the standard library and everything has internal linkage: nothing
+ * built with AVX2 enabled may be shared with (and picked by the linker for)
+ * the scalar path.
+ */
+
+#ifndef BatchKernelBodiesFile
+#define BatchKernelBodiesFile
+
+#include "FastInverseSquareRoots.h++"
+
+#include <cstddef>
+
+namespace FluidEngine
+{
+    namespace Mathematics
+    {
+        namespace BatchKernels
+        {
+            /**
+             * @brief Which elementwise operation an ElementwiseBody does
+             *
+             */
+            enum class Operation
+            {
+                Add,
+                Subtract,
+                Multiply,
+                Divide,
+            };
+
+            /**
+             * @brief Entry points of the SSE2 path (BatchKernels.c++)
+             *
+             */
+            namespace SSE2
+            {
+                template<typename Floating>
+                void Magnitude(const Floating* const (&)[3], Floating*,
+                    std::size_t) noexcept;
+                template<typename Floating>
+                void Normalize(const Floating* const (&)[3],
+                    Floating* const (&)[3], std::size_t) noexcept;
+                template<typename Floating>
+                void FastNormalize(const Floating* const (&)[3],
+                    Floating* const (&)[3], std::size_t) noexcept;
+                template<Operation operation, typename Floating>
+                void Elementwise(const Floating*, const Floating*, Floating*,
+                    std::size_t) noexcept;
+                template<typename Floating>
+                void Reflect(const Floating* const (&)[3],
+                    const Floating* const (&)[3], Floating* const (&)[3],
+                    std::size_t) noexcept;
+                template<typename Floating>
+                void InverseSquareRoot(const Floating*, Floating*,
+                    std::size_t, std::size_t) noexcept;
+            } // namespace SSE2
+
+            /**
+             * @brief Entry points of the AVX2 path (BatchKernelsAVX2.c++)
+             *
+             */
+            namespace AVX2
+            {
+                /**
+                 * @brief Whether BatchKernelsAVX2.c++ was actually built
+                 * with AVX2 enabled (-mavx2). If not, the dispatcher never
+                 * calls the functions below.
+                 *
+                 * @return true if the AVX2 path exists
+                 */
+                bool Compiled() noexcept;
+
+                template<typename Floating>
+                void Magnitude(const Floating* const (&)[3], Floating*,
+                    std::size_t) noexcept;
+                template<typename Floating>
+                void Normalize(const Floating* const (&)[3],
+                    Floating* const (&)[3], std::size_t) noexcept;
+                template<typename Floating>
+                void FastNormalize(const Floating* const (&)[3],
+                    Floating* const (&)[3], std::size_t) noexcept;
+                template<Operation operation, typename Floating>
+                void Elementwise(const Floating*, const Floating*, Floating*,
+                    std::size_t) noexcept;
+                template<typename Floating>
+                void Reflect(const Floating* const (&)[3],
+                    const Floating* const (&)[3], Floating* const (&)[3],
+                    std::size_t) noexcept;
+                template<typename Floating>
+                void InverseSquareRoot(const Floating*, Floating*,
+                    std::size_t, std::size_t) noexcept;
+            } // namespace AVX2
+
+            // internal linkage on purpose, see the note at the top
+            namespace
+            {
+                /**
+                 * @brief "SIMD" lanes that are one element wide. Used for
+                 * the scalar path and for the tail of every SIMD loop.
+                 *
+                 * @tparam Floating
+                 */
+                template<typename Floating>
+                struct ScalarLanes
+                {
+                    using Value = Floating;
+                    using Register = Floating;
+                    static constexpr std::size_t Width = 1;
+
+                    static inline Register Load(const Value* from) noexcept
+                    {
+                        return *from;
+                    }
+                    static inline void Store(Value* to, Register value)
+                    noexcept
+                    {
+                        *to = value;
+                    }
+                    static inline Register Broadcast(Value value) noexcept
+                    {
+                        return value;
+                    }
+                    static inline Register Add(Register lhs, Register rhs)
+                    noexcept
+                    {
+                        return lhs + rhs;
+                    }
+                    static inline Register Subtract
+                    (Register lhs, Register rhs) noexcept
+                    {
+                        return lhs - rhs;
+                    }
+                    static inline Register Multiply
+                    (Register lhs, Register rhs) noexcept
+                    {
+                        return lhs * rhs;
+                    }
+                    static inline Register Divide(Register lhs, Register rhs)
+                    noexcept
+                    {
+                        return lhs / rhs;
+                    }
+                    static inline Register SquareRoot(Register value)
+                    noexcept
+                    {
+                        return __builtin_sqrtl(value);
+                    }
+                    static inline Register InverseSquareRoot(Register value)
+                    noexcept
+                    {
+                        return ::FastInverseSquareRoot(value);
+                    }
+                    static inline Register InverseSquareRootEstimate
+                    (Register value, std::size_t newtonIterations) noexcept
+                    {
+                        return ::FastInverseSquareRoot
+                        (
+                            value,
+                            newtonIterations
+                        );
+                    }
+                };
+
+                /**
+                 * @brief float sqrt without pulling <cmath> in here
+                 *
+                 */
+                template<>
+                inline float ScalarLanes<float>::SquareRoot(float value)
+                noexcept
+                {
+                    return __builtin_sqrtf(value);
+                }
+
+                /**
+                 * @brief double sqrt without pulling <cmath> in here
+                 *
+                 */
+                template<>
+                inline double ScalarLanes<double>::SquareRoot(double value)
+                noexcept
+                {
+                    return __builtin_sqrt(value);
+                }
+
+                /**
+                 * @brief FastInverseSquareRootStep, a register at a time
+                 *
+                 * @param number what to take the inverse square root of
+                 * @param estimate the guess to start from
+                 * @param newtonIterations how many steps to take
+                 */
+                template<typename Lanes>
+                inline typename Lanes::Register InverseSquareRootSteps
+                (
+                    const typename Lanes::Register number,
+                    typename Lanes::Register estimate,
+                    const std::size_t& newtonIterations
+                ) noexcept
+                {
+                    const auto halfOfNumber = Lanes::Multiply
+                    (
+                        number,
+                        Lanes::Broadcast(0.5)
+                    );
+                    const auto threehalfs = Lanes::Broadcast(1.5);
+
+                    for
+                    (
+                        std::size_t iteration = 0;
+                        iteration < newtonIterations;
+                        ++iteration
+                    )
+                    {
+                        estimate = Lanes::Multiply
+                        (
+                            estimate,
+                            Lanes::Subtract
+                            (
+                                threehalfs,
+                                Lanes::Multiply
+                                (
+                                    Lanes::Multiply(halfOfNumber, estimate),
+                                    estimate
+                                )
+                            )
+                        );
+                    }
+                    return estimate;
+                }
+
+                /**
+                 * @brief Runs Lanes over as many whole registers as fit
+                 * @return std::size_t how many elements were processed
+                 */
+                template<typename Lanes>
+                inline std::size_t MagnitudeBody
+                (
+                    const typename Lanes::Value* const (&coordinates)[3],
+                    typename Lanes::Value* magnitudes,
+                    const std::size_t& count,
+                    std::size_t index = 0
+                ) noexcept
+                {
+                    for (; index + Lanes::Width <= count; index += Lanes::Width)
+                    {
+                        const auto x = Lanes::Load(coordinates[0] + index);
+                        const auto y = Lanes::Load(coordinates[1] + index);
+
+                        // same order as VectorBase::Magnitude
+                        auto magnitude = Lanes::Add
+                        (
+                            Lanes::Multiply(x, x),
+                            Lanes::Multiply(y, y)
+                        );
+                        if (coordinates[2] != nullptr)
+                        {
+                            const auto z = Lanes::Load(coordinates[2] + index);
+                            magnitude = Lanes::Add
+                            (
+                                magnitude,
+                                Lanes::Multiply(z, z)
+                            );
+                        }
+
+                        Lanes::Store(magnitudes + index, magnitude);
+                    }
+                    return index;
+                }
+
+                /**
+                 * @brief Scales every coordinate by Scale(magnitude)
+                 * @return std::size_t how many elements were processed
+                 */
+                template<typename Lanes, bool Fast>
+                inline std::size_t NormalizeBody
+                (
+                    const typename Lanes::Value* const (&coordinates)[3],
+                    typename Lanes::Value* const (&normalized)[3],
+                    const std::size_t& count,
+                    std::size_t index = 0
+                ) noexcept
+                {
+                    const std::size_t used = coordinates[2] ? 3 : 2;
+
+                    for (; index + Lanes::Width <= count; index += Lanes::Width)
+                    {
+                        typename Lanes::Register loaded[3];
+                        for (std::size_t axis = 0; axis < used; ++axis)
+                        {
+                            loaded[axis] = Lanes::Load
+                            (
+                                coordinates[axis] + index
+                            );
+                        }
+
+                        auto magnitude = Lanes::Add
+                        (
+                            Lanes::Multiply(loaded[0], loaded[0]),
+                            Lanes::Multiply(loaded[1], loaded[1])
+                        );
+                        if (used == 3)
+                        {
+                            magnitude = Lanes::Add
+                            (
+                                magnitude,
+                                Lanes::Multiply(loaded[2], loaded[2])
+                            );
+                        }
+
+                        if constexpr (Fast)
+                        {
+                            // x * FastInverseSquareRoot(magnitude)
+                            const auto factor = Lanes::InverseSquareRoot
+                            (
+                                magnitude
+                            );
+                            for (std::size_t axis = 0; axis < used; ++axis)
+                            {
+                                Lanes::Store
+                                (
+                                    normalized[axis] + index,
+                                    Lanes::Multiply(loaded[axis], factor)
+                                );
+                            }
+                        }
+                        else
+                        {
+                            // x / sqrt(magnitude)
+                            const auto length = Lanes::SquareRoot(magnitude);
+                            for (std::size_t axis = 0; axis < used; ++axis)
+                            {
+                                Lanes::Store
+                                (
+                                    normalized[axis] + index,
+                                    Lanes::Divide(loaded[axis], length)
+                                );
+                            }
+                        }
+                    }
+                    return index;
+                }
+
+                /**
+                 * @brief result = lhs (operation) rhs
+                 * @return std::size_t how many elements were processed
+                 */
+                template<typename Lanes, Operation operation>
+                inline std::size_t ElementwiseBody
+                (
+                    const typename Lanes::Value* lhs,
+                    const typename Lanes::Value* rhs,
+                    typename Lanes::Value* result,
+                    const std::size_t& count,
+                    std::size_t index = 0
+                ) noexcept
+                {
+                    for (; index + Lanes::Width <= count; index += Lanes::Width)
+                    {
+                        const auto left = Lanes::Load(lhs + index);
+                        const auto right = Lanes::Load(rhs + index);
+
+                        if constexpr (operation == Operation::Add)
+                        {
+                            Lanes::Store
+                            (
+                                result + index,
+                                Lanes::Add(left, right)
+                            );
+                        }
+                        else if constexpr (operation == Operation::Subtract)
+                        {
+                            Lanes::Store
+                            (
+                                result + index,
+                                Lanes::Subtract(left, right)
+                            );
+                        }
+                        else if constexpr (operation == Operation::Multiply)
+                        {
+                            Lanes::Store
+                            (
+                                result + index,
+                                Lanes::Multiply(left, right)
+                            );
+                        }
+                        else
+                        {
+                            Lanes::Store
+                            (
+                                result + index,
+                                Lanes::Divide(left, right)
+                            );
+                        }
+                    }
+                    return index;
+                }
+
+                /**
+                 * @brief reflected = d - (2 (d . n)) n
+                 * @return std::size_t how many elements were processed
+                 */
+                template<typename Lanes>
+                inline std::size_t ReflectBody
+                (
+                    const typename Lanes::Value* const (&directions)[3],
+                    const typename Lanes::Value* const (&normals)[3],
+                    typename Lanes::Value* const (&reflected)[3],
+                    const std::size_t& count,
+                    std::size_t index = 0
+                ) noexcept
+                {
+                    const std::size_t used = directions[2] ? 3 : 2;
+                    const auto two = Lanes::Broadcast(2);
+
+                    for (; index + Lanes::Width <= count; index += Lanes::Width)
+                    {
+                        typename Lanes::Register direction[3];
+                        typename Lanes::Register normal[3];
+                        for (std::size_t axis = 0; axis < used; ++axis)
+                        {
+                            direction[axis] = Lanes::Load
+                            (
+                                directions[axis] + index
+                            );
+                            normal[axis] = Lanes::Load
+                            (
+                                normals[axis] + index
+                            );
+                        }
+
+                        auto dot = Lanes::Add
+                        (
+                            Lanes::Multiply(direction[0], normal[0]),
+                            Lanes::Multiply(direction[1], normal[1])
+                        );
+                        if (used == 3)
+                        {
+                            dot = Lanes::Add
+                            (
+                                dot,
+                                Lanes::Multiply(direction[2], normal[2])
+                            );
+                        }
+                        const auto scale = Lanes::Multiply(two, dot);
+
+                        for (std::size_t axis = 0; axis < used; ++axis)
+                        {
+                            Lanes::Store
+                            (
+                                reflected[axis] + index,
+                                Lanes::Subtract
+                                (
+                                    direction[axis],
+                                    Lanes::Multiply(scale, normal[axis])
+                                )
+                            );
+                        }
+                    }
+                    return index;
+                }
+
+                /**
+                 * @brief results = Lanes::InverseSquareRootEstimate(numbers)
+                 * @return std::size_t how many elements were processed
+                 */
+                template<typename Lanes>
+                inline std::size_t InverseSquareRootBody
+                (
+                    const typename Lanes::Value* numbers,
+                    typename Lanes::Value* results,
+                    const std::size_t& count,
+                    const std::size_t& newtonIterations,
+                    std::size_t index = 0
+                ) noexcept
+                {
+                    for (; index + Lanes::Width <= count; index += Lanes::Width)
+                    {
+                        Lanes::Store
+                        (
+                            results + index,
+                            Lanes::InverseSquareRootEstimate
+                            (
+                                Lanes::Load(numbers + index),
+                                newtonIterations
+                            )
+                        );
+                    }
+                    return index;
+                }
+
+                /**
+                 * @brief Runs the last, partial register through Lanes as
+                 * well (padded with ones), instead of finishing with
+                 * ScalarLanes like the other kernels do.
+                 * @note The SIMD float guess is not the magic number one, so
+                 * this keeps every element of a call within the same error
+                 * bound.
+                 */
+                template<typename Lanes>
+                inline void InverseSquareRootTail
+                (
+                    const typename Lanes::Value* numbers,
+                    typename Lanes::Value* results,
+                    const std::size_t& count,
+                    const std::size_t& newtonIterations,
+                    const std::size_t& index
+                ) noexcept
+                {
+                    if (index == count)
+                    {
+                        return;
+                    }
+
+                    const std::size_t remaining = count - index;
+                    typename Lanes::Value padded[Lanes::Width];
+                    for (std::size_t lane = 0; lane < Lanes::Width; ++lane)
+                    {
+                        padded[lane] = lane < remaining ?
+                                        numbers[index + lane] : 1;
+                    }
+
+                    InverseSquareRootBody<Lanes>
+                    (
+                        padded, padded, Lanes::Width, newtonIterations
+                    );
+
+                    for (std::size_t lane = 0; lane < remaining; ++lane)
+                    {
+                        results[index + lane] = padded[lane];
+                    }
+                }
+
+            } // namespace
+
+        } // namespace BatchKernels
+
+    } // namespace Mathematics
+
+} // namespace FluidEngine
+
+#endif
@@ -0,0 +1,719 @@
+/**
+ * @file BatchKernels.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for BatchKernels.h++: the dispatcher, the scalar
+ * path and the SSE2 path
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "BatchKernels.h++"
+#include "BatchKernelBodies.h++"
+#include "InstructionSets.h++"
+#include "../Diagnostics/Instrumentation.h++"
+
+#include <algorithm>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+using namespace FluidEngine::Mathematics;
+using namespace FluidEngine::Mathematics::BatchKernels;
+
+#ifdef __SSE2__
+/**
+ * @brief 128 bit lanes
+ *
+ * @tparam Floating float or double
+ */
+template<typename Floating>
+struct SSE2Lanes;
+
+/**
+ * @brief 4 floats at a time
+ *
+ */
+template<>
+struct SSE2Lanes<float>
+{
+    using Value = float;
+    using Register = __m128;
+    static constexpr std::size_t Width = 4;
+
+    static inline Register Load(const Value* from) noexcept
+    {
+        return _mm_loadu_ps(from);
+    }
+    static inline void Store(Value* to, Register value) noexcept
+    {
+        _mm_storeu_ps(to, value);
+    }
+    static inline Register Broadcast(Value value) noexcept
+    {
+        return _mm_set1_ps(value);
+    }
+    static inline Register Add(Register lhs, Register rhs) noexcept
+    {
+        return _mm_add_ps(lhs, rhs);
+    }
+    static inline Register Subtract(Register lhs, Register rhs) noexcept
+    {
+        return _mm_sub_ps(lhs, rhs);
+    }
+    static inline Register Multiply(Register lhs, Register rhs) noexcept
+    {
+        return _mm_mul_ps(lhs, rhs);
+    }
+    static inline Register Divide(Register lhs, Register rhs) noexcept
+    {
+        return _mm_div_ps(lhs, rhs);
+    }
+    static inline Register SquareRoot(Register value) noexcept
+    {
+        return _mm_sqrt_ps(value);
+    }
+    /**
+     * @brief FastInverseSquareRootSeed(float), 4 at a time
+     *
+     */
+    static inline Register Seed(Register value) noexcept
+    {
+        const __m128i bits = _mm_sub_epi32
+        (
+            _mm_set1_epi32((int)FastInverseSquareRootMagicLow),
+            _mm_srli_epi32(_mm_castps_si128(value), 1)
+        );
+        return _mm_castsi128_ps(bits);
+    }
+    /**
+     * @brief Same bits as FastInverseSquareRoot(float), 4 at a time
+     *
+     */
+    static inline Register InverseSquareRoot(Register value) noexcept
+    {
+        return InverseSquareRootSteps<SSE2Lanes>
+        (
+            value,
+            Seed(value),
+            FastInverseSquareRootIterations<float>
+        );
+    }
+    /**
+     * @brief _mm_rsqrt_ps's guess (relative error below 1.5 * 2^-12) refined
+     * newtonIterations times
+     *
+     */
+    static inline Register InverseSquareRootEstimate
+    (
+        Register value,
+        std::size_t newtonIterations
+    ) noexcept
+    {
+        return InverseSquareRootSteps<SSE2Lanes>
+        (
+            value,
+            _mm_rsqrt_ps(value),
+            newtonIterations
+        );
+    }
+};
+
+/**
+ * @brief 2 doubles at a time
+ *
+ */
+template<>
+struct SSE2Lanes<double>
+{
+    using Value = double;
+    using Register = __m128d;
+    static constexpr std::size_t Width = 2;
+
+    static inline Register Load(const Value* from) noexcept
+    {
+        return _mm_loadu_pd(from);
+    }
+    static inline void Store(Value* to, Register value) noexcept
+    {
+        _mm_storeu_pd(to, value);
+    }
+    static inline Register Broadcast(Value value) noexcept
+    {
+        return _mm_set1_pd(value);
+    }
+    static inline Register Add(Register lhs, Register rhs) noexcept
+    {
+        return _mm_add_pd(lhs, rhs);
+    }
+    static inline Register Subtract(Register lhs, Register rhs) noexcept
+    {
+        return _mm_sub_pd(lhs, rhs);
+    }
+    static inline Register Multiply(Register lhs, Register rhs) noexcept
+    {
+        return _mm_mul_pd(lhs, rhs);
+    }
+    static inline Register Divide(Register lhs, Register rhs) noexcept
+    {
+        return _mm_div_pd(lhs, rhs);
+    }
+    static inline Register SquareRoot(Register value) noexcept
+    {
+        return _mm_sqrt_pd(value);
+    }
+    /**
+     * @brief FastInverseSquareRootSeed(double), 2 at a time
+     *
+     */
+    static inline Register Seed(Register value) noexcept
+    {
+        const __m128i bits = _mm_sub_epi64
+        (
+            _mm_set1_epi64x((long long)FastInverseSquareRootMagicMid),
+            _mm_srli_epi64(_mm_castpd_si128(value), 1)
+        );
+        return _mm_castsi128_pd(bits);
+    }
+    /**
+     * @brief Same bits as FastInverseSquareRoot(double), 2 at a time
+     *
+     */
+    static inline Register InverseSquareRoot(Register value) noexcept
+    {
+        return InverseSquareRootSteps<SSE2Lanes>
+        (
+            value,
+            Seed(value),
+            FastInverseSquareRootIterations<double>
+        );
+    }
+    /**
+     * @brief Same bits as FastInverseSquareRoot(double, newtonIterations)
+     * (there is no hardware guess for doubles below AVX-512)
+     *
+     */
+    static inline Register InverseSquareRootEstimate
+    (
+        Register value,
+        std::size_t newtonIterations
+    ) noexcept
+    {
+        return InverseSquareRootSteps<SSE2Lanes>
+        (
+            value,
+            Seed(value),
+            newtonIterations
+        );
+    }
+};
+#else
+/**
+ * @brief Without SSE2 the "SSE2" path is just the scalar one
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+struct SSE2Lanes : ScalarLanes<Floating>
+{
+    /*left blank*/
+};
+#endif
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::SSE2::Magnitude
+(
+    const Floating* const (&coordinates)[3],
+    Floating* magnitudes,
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = MagnitudeBody<SSE2Lanes<Floating>>
+    (
+        coordinates, magnitudes, count
+    );
+    MagnitudeBody<ScalarLanes<Floating>>
+    (
+        coordinates, magnitudes, count, done
+    );
+}
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::SSE2::Normalize
+(
+    const Floating* const (&coordinates)[3],
+    Floating* const (&normalized)[3],
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = NormalizeBody<SSE2Lanes<Floating>, false>
+    (
+        coordinates, normalized, count
+    );
+    NormalizeBody<ScalarLanes<Floating>, false>
+    (
+        coordinates, normalized, count, done
+    );
+}
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::SSE2::FastNormalize
+(
+    const Floating* const (&coordinates)[3],
+    Floating* const (&normalized)[3],
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = NormalizeBody<SSE2Lanes<Floating>, true>
+    (
+        coordinates, normalized, count
+    );
+    NormalizeBody<ScalarLanes<Floating>, true>
+    (
+        coordinates, normalized, count, done
+    );
+}
+
+template<Operation operation, typename Floating>
+void FluidEngine::Mathematics::BatchKernels::SSE2::Elementwise
+(
+    const Floating* lhs,
+    const Floating* rhs,
+    Floating* result,
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = ElementwiseBody<SSE2Lanes<Floating>, operation>
+    (
+        lhs, rhs, result, count
+    );
+    ElementwiseBody<ScalarLanes<Floating>, operation>
+    (
+        lhs, rhs, result, count, done
+    );
+}
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::SSE2::Reflect
+(
+    const Floating* const (&directions)[3],
+    const Floating* const (&normals)[3],
+    Floating* const (&reflected)[3],
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = ReflectBody<SSE2Lanes<Floating>>
+    (
+        directions, normals, reflected, count
+    );
+    ReflectBody<ScalarLanes<Floating>>
+    (
+        directions, normals, reflected, count, done
+    );
+}
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::SSE2::InverseSquareRoot
+(
+    const Floating* numbers,
+    Floating* results,
+    std::size_t count,
+    std::size_t newtonIterations
+) noexcept
+{
+    const std::size_t done = InverseSquareRootBody<SSE2Lanes<Floating>>
+    (
+        numbers, results, count, newtonIterations
+    );
+    InverseSquareRootTail<SSE2Lanes<Floating>>
+    (
+        numbers, results, count, newtonIterations, done
+    );
+}
+
+/**
+ * @brief long double has no SIMD path, everything else does
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+static constexpr bool HasSIMDPath =
+    !std::is_same<Floating, long double>::value;
+
+/**
+ * @brief Which path to take for the next kernel call
+ * @author Joshua Buchanan
+ * @return InstructionSet
+ */
+static inline InstructionSet ActivePath() noexcept
+{
+    const InstructionSet active = ActiveInstructionSet();
+    if (active == InstructionSet::AVX2 && !AVX2::Compiled())
+    {
+        return InstructionSet::SSE2;
+    }
+    return active;
+}
+
+/**
+ * @brief Raw pointers to the columns, nullptr for an empty third column
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+struct Pointers
+{
+    Floating* columns[3];
+
+    template<typename Span>
+    Pointers(const std::array<Span, 3>& spans) noexcept
+    {
+        for (std::size_t column = 0; column < 3; ++column)
+        {
+            this->columns[column] = spans[column].empty() ?
+                                nullptr : spans[column].data();
+        }
+    }
+};
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+void FluidEngine::Mathematics::BatchKernels::Magnitude
+(
+    const ConstColumns<Floating>& coordinates,
+    std::span<Floating> magnitudes
+) noexcept
+{
+    const Pointers<const Floating> in(coordinates);
+
+    if constexpr (HasSIMDPath<Floating>)
+    {
+        switch (ActivePath())
+        {
+        case InstructionSet::AVX2:
+            AVX2::Magnitude(in.columns, magnitudes.data(), magnitudes.size());
+            return;
+        case InstructionSet::SSE2:
+            SSE2::Magnitude(in.columns, magnitudes.data(), magnitudes.size());
+            return;
+        default:
+            break;
+        }
+    }
+
+    MagnitudeBody<ScalarLanes<Floating>>
+    (
+        in.columns, magnitudes.data(), magnitudes.size()
+    );
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+void FluidEngine::Mathematics::BatchKernels::Normalize
+(
+    const ConstColumns<Floating>& coordinates,
+    const Columns<Floating>& normalized
+) noexcept
+{
+    const Pointers<const Floating> in(coordinates);
+    const Pointers<Floating> out(normalized);
+    const std::size_t count = normalized[0].size();
+    FluidEngineCountBy(VectorsNormalized, count);
+    FluidEngineCountBy(ExactPathHits, count);
+
+    if constexpr (HasSIMDPath<Floating>)
+    {
+        switch (ActivePath())
+        {
+        case InstructionSet::AVX2:
+            AVX2::Normalize(in.columns, out.columns, count);
+            return;
+        case InstructionSet::SSE2:
+            SSE2::Normalize(in.columns, out.columns, count);
+            return;
+        default:
+            break;
+        }
+    }
+
+    NormalizeBody<ScalarLanes<Floating>, false>
+    (
+        in.columns, out.columns, count
+    );
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+void FluidEngine::Mathematics::BatchKernels::FastNormalize
+(
+    const ConstColumns<Floating>& coordinates,
+    const Columns<Floating>& normalized
+) noexcept
+{
+    const Pointers<const Floating> in(coordinates);
+    const Pointers<Floating> out(normalized);
+    const std::size_t count = normalized[0].size();
+    FluidEngineCountBy(VectorsNormalized, count);
+    FluidEngineCountBy(FastPathHits, count);
+
+    if constexpr (HasSIMDPath<Floating>)
+    {
+        switch (ActivePath())
+        {
+        case InstructionSet::AVX2:
+            AVX2::FastNormalize(in.columns, out.columns, count);
+            return;
+        case InstructionSet::SSE2:
+            SSE2::FastNormalize(in.columns, out.columns, count);
+            return;
+        default:
+            break;
+        }
+    }
+
+    NormalizeBody<ScalarLanes<Floating>, true>
+    (
+        in.columns, out.columns, count
+    );
+}
+
+/**
+ * @brief Shared dispatch of Add, Subtract, Multiply and Divide
+ * @author Joshua Buchanan
+ */
+template<Operation operation, typename Floating>
+static inline void DispatchElementwise
+(
+    std::span<const Floating> lhs,
+    std::span<const Floating> rhs,
+    std::span<Floating> result
+) noexcept
+{
+    if constexpr (HasSIMDPath<Floating>)
+    {
+        switch (ActivePath())
+        {
+        case InstructionSet::AVX2:
+            AVX2::Elementwise<operation>
+            (
+                lhs.data(), rhs.data(), result.data(), result.size()
+            );
+            return;
+        case InstructionSet::SSE2:
+            SSE2::Elementwise<operation>
+            (
+                lhs.data(), rhs.data(), result.data(), result.size()
+            );
+            return;
+        default:
+            break;
+        }
+    }
+
+    ElementwiseBody<ScalarLanes<Floating>, operation>
+    (
+        lhs.data(), rhs.data(), result.data(), result.size()
+    );
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+void FluidEngine::Mathematics::BatchKernels::Add
+(
+    std::span<const Floating> lhs,
+    std::span<const Floating> rhs,
+    std::span<Floating> sum
+) noexcept
+{
+    DispatchElementwise<Operation::Add, Floating>(lhs, rhs, sum);
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+void FluidEngine::Mathematics::BatchKernels::Subtract
+(
+    std::span<const Floating> lhs,
+    std::span<const Floating> rhs,
+    std::span<Floating> difference
+) noexcept
+{
+    DispatchElementwise<Operation::Subtract, Floating>(lhs, rhs, difference);
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+void FluidEngine::Mathematics::BatchKernels::Multiply
+(
+    std::span<const Floating> lhs,
+    std::span<const Floating> rhs,
+    std::span<Floating> product
+) noexcept
+{
+    DispatchElementwise<Operation::Multiply, Floating>(lhs, rhs, product);
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+void FluidEngine::Mathematics::BatchKernels::Divide
+(
+    std::span<const Floating> lhs,
+    std::span<const Floating> rhs,
+    std::span<Floating> quotient
+) noexcept
+{
+    DispatchElementwise<Operation::Divide, Floating>(lhs, rhs, quotient);
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+void FluidEngine::Mathematics::BatchKernels::Reflect
+(
+    const ConstColumns<Floating>& directions,
+    const ConstColumns<Floating>& normals,
+    const Columns<Floating>& reflected
+) noexcept
+{
+    const Pointers<const Floating> in(directions);
+    const Pointers<const Floating> surfaces(normals);
+    const Pointers<Floating> out(reflected);
+    const std::size_t count = reflected[0].size();
+
+    if constexpr (HasSIMDPath<Floating>)
+    {
+        switch (ActivePath())
+        {
+        case InstructionSet::AVX2:
+            AVX2::Reflect(in.columns, surfaces.columns, out.columns, count);
+            return;
+        case InstructionSet::SSE2:
+            SSE2::Reflect(in.columns, surfaces.columns, out.columns, count);
+            return;
+        default:
+            break;
+        }
+    }
+
+    ReflectBody<ScalarLanes<Floating>>
+    (
+        in.columns, surfaces.columns, out.columns, count
+    );
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+void FluidEngine::Mathematics::BatchKernels::FastInverseSquareRoot
+(
+    std::span<const Floating> numbers,
+    std::span<Floating> results,
+    const std::size_t& newtonIterations
+) noexcept
+{
+    if constexpr (HasSIMDPath<Floating>)
+    {
+        switch (ActivePath())
+        {
+        case InstructionSet::AVX2:
+            AVX2::InverseSquareRoot
+            (
+                numbers.data(), results.data(), results.size(),
+                newtonIterations
+            );
+            return;
+        case InstructionSet::SSE2:
+            SSE2::InverseSquareRoot
+            (
+                numbers.data(), results.data(), results.size(),
+                newtonIterations
+            );
+            return;
+        default:
+            break;
+        }
+    }
+
+    InverseSquareRootBody<ScalarLanes<Floating>>
+    (
+        numbers.data(), results.data(), results.size(), newtonIterations
+    );
+}
+
+/**
+ * @brief Measured maximum relative error of the magic number guess after
+ * 0, 1, 2, 3 and 4 newton iterations (the last one is the precision floor)
+ * @note float: every positive normal float, double and long double: 20
+ * million random positive numbers
+ */
+template<typename Floating>
+static constexpr double magicNumberErrors[5] =
+    {3.44e-2, 1.76e-3, 4.74e-6, 1.91e-7, 1.91e-7};
+template<>
+constexpr double magicNumberErrors<double>[5] =
+    {3.44e-2, 1.76e-3, 4.7e-6, 3.2e-11, 3.3e-16};
+template<>
+constexpr double magicNumberErrors<long double>[5] =
+    {3.44e-2, 1.76e-3, 4.7e-6, 3.2e-11, 2.1e-19};
+
+/**
+ * @brief Maximum relative error of the rsqrtps guess after 0, 1 and 2 newton
+ * iterations. 0 is what Intel and AMD document (1.5 * 2^-12), the others
+ * follow from it (1.5 e^2 plus rounding).
+ */
+static constexpr double hardwareGuessErrors[3] = {3.67e-4, 4.1e-7, 1.91e-7};
+
+template<FluidEngine::Concepts::UsableInVectorBase Floating>
+double FluidEngine::Mathematics::BatchKernels::FastInverseSquareRootMaximumError
+(
+    const InstructionSet& path,
+    const std::size_t& newtonIterations
+) noexcept
+{
+#ifdef __SSE2__
+    const bool hardwareGuess = path != InstructionSet::Scalar;
+#else
+    const bool hardwareGuess = path == InstructionSet::AVX2 &&
+                                AVX2::Compiled();
+#endif
+
+    if (std::is_same<Floating, float>::value && hardwareGuess)
+    {
+        return hardwareGuessErrors[std::min<std::size_t>(newtonIterations, 2)];
+    }
+    return magicNumberErrors<Floating>
+    [
+        std::min<std::size_t>(newtonIterations, 4)
+    ];
+}
+
+//-----------------------------------------------------------------------------
+// Explicit instantiations, so that the definitions can live in here
+//-----------------------------------------------------------------------------
+
+#define InstantiateBatchKernels(Floating) \
+template void FluidEngine::Mathematics::BatchKernels::Magnitude<Floating> \
+(const ConstColumns<Floating>&, std::span<Floating>) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::Normalize<Floating> \
+(const ConstColumns<Floating>&, const Columns<Floating>&) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::FastNormalize<Floating> \
+(const ConstColumns<Floating>&, const Columns<Floating>&) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::Add<Floating> \
+(std::span<const Floating>, std::span<const Floating>, std::span<Floating>) \
+noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::Subtract<Floating> \
+(std::span<const Floating>, std::span<const Floating>, std::span<Floating>) \
+noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::Multiply<Floating> \
+(std::span<const Floating>, std::span<const Floating>, std::span<Floating>) \
+noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::Divide<Floating> \
+(std::span<const Floating>, std::span<const Floating>, std::span<Floating>) \
+noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::Reflect<Floating> \
+(const ConstColumns<Floating>&, const ConstColumns<Floating>&, \
+const Columns<Floating>&) noexcept; \
+template void \
+FluidEngine::Mathematics::BatchKernels::FastInverseSquareRoot<Floating> \
+(std::span<const Floating>, std::span<Floating>, const std::size_t&) noexcept; \
+template double \
+FluidEngine::Mathematics::BatchKernels::FastInverseSquareRootMaximumError \
+<Floating>(const InstructionSet&, const std::size_t&) noexcept;
+
+InstantiateBatchKernels(float)
+InstantiateBatchKernels(double)
+InstantiateBatchKernels(long double)
+
+#undef InstantiateBatchKernels
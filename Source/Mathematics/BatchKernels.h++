@@ -0,0 +1,226 @@
+/**
+ * @file BatchKernels.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Column-at-a-time versions of the VectorBase math
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef BatchKernelsFile
+#define BatchKernelsFile
+
+#include "FastInverseSquareRoots.h++"
+#include "InstructionSets.h++"
+#include "../Concepts/Concepts.h++"
+
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace FluidEngine
+{
+    namespace Mathematics
+    {
+        /**
+         * @brief Kernels that run the VectorBase math over whole columns of
+         * coordinates (structure of arrays) instead of one VectorBase at a
+         * time.
+         * @details
+         * Every kernel picks the best path for ActiveInstructionSet() at
+         * runtime (AVX2, SSE2 or plain scalar). The SIMD paths do the exact
+         * same operations in the exact same order as the scalar one, so all
+         * paths give bit-identical results (the one exception is
+         * FastInverseSquareRoot for float, see there). long double has no
+         * SIMD path.
+         *
+         * The number of elements processed is always the size of the output
+         * span; inputs must be at least that long. A 2 dimensional batch
+         * passes an empty span as its third column (in and out).
+         * @author Joshua Buchanan
+         */
+        namespace BatchKernels
+        {
+            /**
+             * @brief The three coordinate columns of a batch, read only
+             *
+             * @tparam Floating
+             */
+            template<typename Floating>
+            using ConstColumns = std::array<std::span<const Floating>, 3>;
+
+            /**
+             * @brief The three coordinate columns of a batch
+             *
+             * @tparam Floating
+             */
+            template<typename Floating>
+            using Columns = std::array<std::span<Floating>, 3>;
+
+            /**
+             * @brief Same as VectorBase::Magnitude for rectangular vectors
+             * (the squared length)
+             * @author Joshua Buchanan
+             * @param coordinates x, y and z columns
+             * @param magnitudes where to put the results
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            void Magnitude
+            (
+                const ConstColumns<Floating>& coordinates,
+                std::span<Floating> magnitudes
+            ) noexcept;
+
+            /**
+             * @brief Same as VectorBase::NormalizedForm for rectangular
+             * vectors
+             * @author Joshua Buchanan
+             * @param coordinates x, y and z columns
+             * @param normalized where to put the results (may alias
+             * coordinates)
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            void Normalize
+            (
+                const ConstColumns<Floating>& coordinates,
+                const Columns<Floating>& normalized
+            ) noexcept;
+
+            /**
+             * @brief Same as VectorBase::FastNormalize for rectangular
+             * vectors
+             * @author Joshua Buchanan
+             * @param coordinates x, y and z columns
+             * @param normalized where to put the results (may alias
+             * coordinates)
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            void FastNormalize
+            (
+                const ConstColumns<Floating>& coordinates,
+                const Columns<Floating>& normalized
+            ) noexcept;
+
+            /**
+             * @brief sum[i] = lhs[i] + rhs[i]
+             * @author Joshua Buchanan
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            void Add
+            (
+                std::span<const Floating> lhs,
+                std::span<const Floating> rhs,
+                std::span<Floating> sum
+            ) noexcept;
+
+            /**
+             * @brief difference[i] = lhs[i] - rhs[i]
+             * @author Joshua Buchanan
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            void Subtract
+            (
+                std::span<const Floating> lhs,
+                std::span<const Floating> rhs,
+                std::span<Floating> difference
+            ) noexcept;
+
+            /**
+             * @brief product[i] = lhs[i] * rhs[i]
+             * @author Joshua Buchanan
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            void Multiply
+            (
+                std::span<const Floating> lhs,
+                std::span<const Floating> rhs,
+                std::span<Floating> product
+            ) noexcept;
+
+            /**
+             * @brief quotient[i] = lhs[i] / rhs[i]
+             * @author Joshua Buchanan
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            void Divide
+            (
+                std::span<const Floating> lhs,
+                std::span<const Floating> rhs,
+                std::span<Floating> quotient
+            ) noexcept;
+
+            /**
+             * @brief Reflects each direction about its (unit) normal:
+             * d - 2 (d . n) n
+             * @author Joshua Buchanan
+             * @param directions the vectors to reflect
+             * @param normals unit normals of the reflecting surfaces
+             * @param reflected where to put the results
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            void Reflect
+            (
+                const ConstColumns<Floating>& directions,
+                const ConstColumns<Floating>& normals,
+                const Columns<Floating>& reflected
+            ) noexcept;
+
+            /**
+             * @brief results[i] ~= 1 / sqrt(numbers[i]) for positive numbers
+             * @details
+             * A guess refined by newtonIterations newton iterations; every
+             * iteration roughly squares the relative error, until the
+             * precision of Floating is reached.
+             *
+             * On the SIMD paths the float guess comes from the hardware
+             * (rsqrtps), which is ~100 times closer than the magic number
+             * one, so 1 iteration already gets close to float precision.
+             * Everywhere else (scalar floats, doubles, long doubles) the
+             * results are the same bits as the scalar
+             * ::FastInverseSquareRoot(number, newtonIterations).
+             *
+             * FastInverseSquareRootMaximumError tells the maximum relative
+             * error of each combination; the tests check it against every
+             * positive normal float.
+             * @note Results for 0, negative, subnormal, infinite or NaN
+             * inputs are not meaningful (except for long double).
+             * @author Joshua Buchanan
+             * @param numbers what to take the inverse square roots of
+             * @param results where to put them (may alias numbers)
+             * @param newtonIterations how much to refine the guess
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            void FastInverseSquareRoot
+            (
+                std::span<const Floating> numbers,
+                std::span<Floating> results,
+                const std::size_t& newtonIterations =
+                    FastInverseSquareRootIterations<Floating>
+            ) noexcept;
+
+            /**
+             * @brief The guaranteed maximum relative error of
+             * FastInverseSquareRoot for positive normal inputs
+             * @author Joshua Buchanan
+             * @param path the instruction set the kernel runs with
+             * @param newtonIterations the newton iterations it does
+             * @return double
+             */
+            template<Concepts::UsableInVectorBase Floating>
+            double FastInverseSquareRootMaximumError
+            (
+                const InstructionSet& path,
+                const std::size_t& newtonIterations =
+                    FastInverseSquareRootIterations<Floating>
+            ) noexcept;
+
+        } // namespace BatchKernels
+
+    } // namespace Mathematics
+
+} // namespace FluidEngine
+
+
+#endif
@@ -0,0 +1,376 @@
+/**
+ * @file BatchKernelsAVX2.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief The AVX2 path of BatchKernels.h++
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ * @note This is the only file that gets compiled with -mavx2 (see the
+ * Makefile). It is only ever called after DetectInstructionSet() said AVX2
+ * is there, so do not include anything in here that other files share.
+ */
+
+#include "BatchKernelBodies.h++"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+using namespace FluidEngine::Mathematics::BatchKernels;
+
+#ifdef __AVX2__
+/**
+ * @brief 256 bit lanes
+ *
+ * @tparam Floating float or double
+ */
+template<typename Floating>
+struct AVX2Lanes;
+
+/**
+ * @brief 8 floats at a time
+ *
+ */
+template<>
+struct AVX2Lanes<float>
+{
+    using Value = float;
+    using Register = __m256;
+    static constexpr std::size_t Width = 8;
+
+    static inline Register Load(const Value* from) noexcept
+    {
+        return _mm256_loadu_ps(from);
+    }
+    static inline void Store(Value* to, Register value) noexcept
+    {
+        _mm256_storeu_ps(to, value);
+    }
+    static inline Register Broadcast(Value value) noexcept
+    {
+        return _mm256_set1_ps(value);
+    }
+    static inline Register Add(Register lhs, Register rhs) noexcept
+    {
+        return _mm256_add_ps(lhs, rhs);
+    }
+    static inline Register Subtract(Register lhs, Register rhs) noexcept
+    {
+        return _mm256_sub_ps(lhs, rhs);
+    }
+    static inline Register Multiply(Register lhs, Register rhs) noexcept
+    {
+        return _mm256_mul_ps(lhs, rhs);
+    }
+    static inline Register Divide(Register lhs, Register rhs) noexcept
+    {
+        return _mm256_div_ps(lhs, rhs);
+    }
+    static inline Register SquareRoot(Register value) noexcept
+    {
+        return _mm256_sqrt_ps(value);
+    }
+    /**
+     * @brief FastInverseSquareRootSeed(float), 8 at a time
+     *
+     */
+    static inline Register Seed(Register value) noexcept
+    {
+        const __m256i bits = _mm256_sub_epi32
+        (
+            _mm256_set1_epi32((int)FastInverseSquareRootMagicLow),
+            _mm256_srli_epi32(_mm256_castps_si256(value), 1)
+        );
+        return _mm256_castsi256_ps(bits);
+    }
+    /**
+     * @brief Same bits as FastInverseSquareRoot(float), 8 at a time
+     *
+     */
+    static inline Register InverseSquareRoot(Register value) noexcept
+    {
+        return InverseSquareRootSteps<AVX2Lanes>
+        (
+            value,
+            Seed(value),
+            FastInverseSquareRootIterations<float>
+        );
+    }
+    /**
+     * @brief _mm256_rsqrt_ps's guess (relative error below 1.5 * 2^-12) refined
+     * newtonIterations times
+     *
+     */
+    static inline Register InverseSquareRootEstimate
+    (
+        Register value,
+        std::size_t newtonIterations
+    ) noexcept
+    {
+        return InverseSquareRootSteps<AVX2Lanes>
+        (
+            value,
+            _mm256_rsqrt_ps(value),
+            newtonIterations
+        );
+    }
+};
+
+/**
+ * @brief 4 doubles at a time
+ *
+ */
+template<>
+struct AVX2Lanes<double>
+{
+    using Value = double;
+    using Register = __m256d;
+    static constexpr std::size_t Width = 4;
+
+    static inline Register Load(const Value* from) noexcept
+    {
+        return _mm256_loadu_pd(from);
+    }
+    static inline void Store(Value* to, Register value) noexcept
+    {
+        _mm256_storeu_pd(to, value);
+    }
+    static inline Register Broadcast(Value value) noexcept
+    {
+        return _mm256_set1_pd(value);
+    }
+    static inline Register Add(Register lhs, Register rhs) noexcept
+    {
+        return _mm256_add_pd(lhs, rhs);
+    }
+    static inline Register Subtract(Register lhs, Register rhs) noexcept
+    {
+        return _mm256_sub_pd(lhs, rhs);
+    }
+    static inline Register Multiply(Register lhs, Register rhs) noexcept
+    {
+        return _mm256_mul_pd(lhs, rhs);
+    }
+    static inline Register Divide(Register lhs, Register rhs) noexcept
+    {
+        return _mm256_div_pd(lhs, rhs);
+    }
+    static inline Register SquareRoot(Register value) noexcept
+    {
+        return _mm256_sqrt_pd(value);
+    }
+    /**
+     * @brief FastInverseSquareRootSeed(double), 4 at a time
+     *
+     */
+    static inline Register Seed(Register value) noexcept
+    {
+        const __m256i bits = _mm256_sub_epi64
+        (
+            _mm256_set1_epi64x((long long)FastInverseSquareRootMagicMid),
+            _mm256_srli_epi64(_mm256_castpd_si256(value), 1)
+        );
+        return _mm256_castsi256_pd(bits);
+    }
+    /**
+     * @brief Same bits as FastInverseSquareRoot(double), 4 at a time
+     *
+     */
+    static inline Register InverseSquareRoot(Register value) noexcept
+    {
+        return InverseSquareRootSteps<AVX2Lanes>
+        (
+            value,
+            Seed(value),
+            FastInverseSquareRootIterations<double>
+        );
+    }
+    /**
+     * @brief Same bits as FastInverseSquareRoot(double, newtonIterations)
+     * (there is no hardware guess for doubles below AVX-512)
+     *
+     */
+    static inline Register InverseSquareRootEstimate
+    (
+        Register value,
+        std::size_t newtonIterations
+    ) noexcept
+    {
+        return InverseSquareRootSteps<AVX2Lanes>
+        (
+            value,
+            Seed(value),
+            newtonIterations
+        );
+    }
+};
+
+bool FluidEngine::Mathematics::BatchKernels::AVX2::Compiled() noexcept
+{
+    return true;
+}
+#else
+/**
+ * @brief Built without -mavx2: keep the symbols around, but tell the
+ * dispatcher not to use them
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+struct AVX2Lanes : ScalarLanes<Floating>
+{
+    /*left blank*/
+};
+
+bool FluidEngine::Mathematics::BatchKernels::AVX2::Compiled() noexcept
+{
+    return false;
+}
+#endif
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::AVX2::Magnitude
+(
+    const Floating* const (&coordinates)[3],
+    Floating* magnitudes,
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = MagnitudeBody<AVX2Lanes<Floating>>
+    (
+        coordinates, magnitudes, count
+    );
+    MagnitudeBody<ScalarLanes<Floating>>
+    (
+        coordinates, magnitudes, count, done
+    );
+}
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::AVX2::Normalize
+(
+    const Floating* const (&coordinates)[3],
+    Floating* const (&normalized)[3],
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = NormalizeBody<AVX2Lanes<Floating>, false>
+    (
+        coordinates, normalized, count
+    );
+    NormalizeBody<ScalarLanes<Floating>, false>
+    (
+        coordinates, normalized, count, done
+    );
+}
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::AVX2::FastNormalize
+(
+    const Floating* const (&coordinates)[3],
+    Floating* const (&normalized)[3],
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = NormalizeBody<AVX2Lanes<Floating>, true>
+    (
+        coordinates, normalized, count
+    );
+    NormalizeBody<ScalarLanes<Floating>, true>
+    (
+        coordinates, normalized, count, done
+    );
+}
+
+template<Operation operation, typename Floating>
+void FluidEngine::Mathematics::BatchKernels::AVX2::Elementwise
+(
+    const Floating* lhs,
+    const Floating* rhs,
+    Floating* result,
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = ElementwiseBody<AVX2Lanes<Floating>, operation>
+    (
+        lhs, rhs, result, count
+    );
+    ElementwiseBody<ScalarLanes<Floating>, operation>
+    (
+        lhs, rhs, result, count, done
+    );
+}
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::AVX2::Reflect
+(
+    const Floating* const (&directions)[3],
+    const Floating* const (&normals)[3],
+    Floating* const (&reflected)[3],
+    std::size_t count
+) noexcept
+{
+    const std::size_t done = ReflectBody<AVX2Lanes<Floating>>
+    (
+        directions, normals, reflected, count
+    );
+    ReflectBody<ScalarLanes<Floating>>
+    (
+        directions, normals, reflected, count, done
+    );
+}
+
+template<typename Floating>
+void FluidEngine::Mathematics::BatchKernels::AVX2::InverseSquareRoot
+(
+    const Floating* numbers,
+    Floating* results,
+    std::size_t count,
+    std::size_t newtonIterations
+) noexcept
+{
+    const std::size_t done = InverseSquareRootBody<AVX2Lanes<Floating>>
+    (
+        numbers, results, count, newtonIterations
+    );
+    InverseSquareRootTail<AVX2Lanes<Floating>>
+    (
+        numbers, results, count, newtonIterations, done
+    );
+}
+
+//-----------------------------------------------------------------------------
+// Explicit instantiations (float and double only, long double stays scalar)
+//-----------------------------------------------------------------------------
+
+#define InstantiateAVX2Kernels(Floating) \
+template void FluidEngine::Mathematics::BatchKernels::AVX2::Magnitude \
+(const Floating* const (&)[3], Floating*, std::size_t) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::AVX2::Normalize \
+(const Floating* const (&)[3], Floating* const (&)[3], std::size_t) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::AVX2::FastNormalize \
+(const Floating* const (&)[3], Floating* const (&)[3], std::size_t) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::AVX2::Elementwise \
+<Operation::Add>(const Floating*, const Floating*, Floating*, std::size_t) \
+noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::AVX2::Elementwise \
+<Operation::Subtract>(const Floating*, const Floating*, Floating*, \
+std::size_t) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::AVX2::Elementwise \
+<Operation::Multiply>(const Floating*, const Floating*, Floating*, \
+std::size_t) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::AVX2::Elementwise \
+<Operation::Divide>(const Floating*, const Floating*, Floating*, \
+std::size_t) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::AVX2::Reflect \
+(const Floating* const (&)[3], const Floating* const (&)[3], \
+Floating* const (&)[3], std::size_t) noexcept; \
+template void FluidEngine::Mathematics::BatchKernels::AVX2::InverseSquareRoot \
+(const Floating*, Floating*, std::size_t, std::size_t) noexcept;
+
+InstantiateAVX2Kernels(float)
+InstantiateAVX2Kernels(double)
+
+#undef InstantiateAVX2Kernels
@@ -12,75 +12,215 @@
 #ifndef FastInverseSquareRootsFile
 #define FastInverseSquareRootsFile
 
+#include <cstddef>
 #include <cstdint>
-// bc not implemented long double ... yet!
-#include <cmath>
 #include <limits>
 #include <bit>
 
 #define sigma (188939.0 / 4194304.0l)
 
 /**
- * @brief Fast inverse square root approximation
- * 
- * @param number 
- * @return constexpr float 
+ * @brief The Q_rsqrt magic number for float (0x5f3759df).
+ * @note 1.5 * 2^mantissaBits * (exponentBias - sigma). Shared with the batch
+ * kernels so that the SIMD paths produce the same bits as the scalar one.
  */
-static constexpr inline float FastInverseSquareRoot(float number)
-{
-    const float halfOfNumber = number * 0.5f;
-    const float threehalfs = 1.5f;
+inline constexpr uint32_t FastInverseSquareRootMagicLow =
+    (uint32_t)(1.5l * (1LLU << 23) * ((1LLU << 7) - 1 - sigma));
 
-    const uint32_t magic = (uint32_t)( 1.5l * (2LLU << 23) * ((2LLU << 7) - sigma));
+/**
+ * @brief The Q_rsqrt magic number for double.
+ * @see FastInverseSquareRootMagicLow
+ */
+inline constexpr uint64_t FastInverseSquareRootMagicMid =
+    (uint64_t)(1.5l * (1LLU << 52) * ((1LLU << 10) - 1 - sigma));
 
-    // my c++20 headers are incomplete, I have to resort to undefined behavior
-    // TODO: #14 fix me
-    auto i = *(uint32_t*)&number;
-    i = magic - ( i >> 1);
-    number = *(float*)&i;
-    number *= threehalfs - (halfOfNumber * number * number);
+/**
+ * @brief How many newton iterations FastInverseSquareRoot does by default
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+inline constexpr std::size_t FastInverseSquareRootIterations = 1;
+template<>
+inline constexpr std::size_t FastInverseSquareRootIterations<double> = 2;
+template<>
+inline constexpr std::size_t FastInverseSquareRootIterations<long double> = 4;
 
-    return number;
+/**
+ * @brief The magic number guess for 1 / sqrt(number), before any newton
+ * iterations (relative error up to ~3.5%)
+ *
+ * @param number
+ * @return constexpr float
+ */
+static constexpr inline float FastInverseSquareRootSeed(float number)
+{
+    const uint32_t magic = FastInverseSquareRootMagicLow;
+    const uint32_t bits = std::bit_cast<uint32_t>(number);
+    return std::bit_cast<float>(magic - (bits >> 1));
 }
 
 /**
- * @brief Fast inverse square root approximation
- * 
- * @param number 
- * @return constexpr double 
+ * @brief The magic number guess for 1 / sqrt(number), before any newton
+ * iterations (relative error up to ~3.5%)
+ *
+ * @param number
+ * @return constexpr double
  */
-static constexpr inline double FastInverseSquareRoot(double number)
+static constexpr inline double FastInverseSquareRootSeed(double number)
 {
-    const double halfOfNumber = number * 0.5;
-    const double threehalfs = 1.5;
+    const uint64_t magic = FastInverseSquareRootMagicMid;
+    const uint64_t bits = std::bit_cast<uint64_t>(number);
+    return std::bit_cast<double>(magic - (bits >> 1));
+}
 
-    const uint64_t magic = (uint64_t)(1.5l * (2LLU << 52) * ((2LLU << 10) - sigma));
+/**
+ * @brief One newton iteration for 1 / sqrt(number). Roughly squares the
+ * relative error (e -> 1.5 e^2).
+ *
+ * @tparam Floating
+ * @param halfOfNumber number * 0.5
+ * @param estimate the current guess
+ * @return constexpr Floating the better guess
+ */
+template<typename Floating>
+static constexpr inline Floating FastInverseSquareRootStep
+(
+    const Floating halfOfNumber,
+    const Floating estimate
+)
+{
+    const Floating threehalfs = 1.5;
+    return estimate * (threehalfs - (halfOfNumber * estimate * estimate));
+}
 
-    // my c++ 20 headers are incomplete, I have to resort to undefined behavior
-    // TODO: #14 fix me
+/**
+ * @brief Fast inverse square root approximation
+ * @note Maximum relative error, measured over every positive normal float:
+ * 0 iterations: 3.44e-2, 1: 1.76e-3, 2: 4.74e-6, 3 or more: 1.91e-7
+ * @param number
+ * @param newtonIterations how much to refine the magic number guess
+ * @return constexpr float
+ */
+static constexpr inline float FastInverseSquareRoot
+(
+    float number,
+    const std::size_t newtonIterations = FastInverseSquareRootIterations<float>
+)
+{
+    const float halfOfNumber = number * 0.5f;
 
-    auto i = *(uint64_t*)&number;
+    number = FastInverseSquareRootSeed(number);
+    for (std::size_t iteration = 0; iteration < newtonIterations; ++iteration)
+    {
+        number = FastInverseSquareRootStep(halfOfNumber, number);
+    }
 
-    i = magic - ( i >> 1);
+    return number;
+}
 
-    number = *(double*)&i;
+/**
+ * @brief Fast inverse square root approximation
+ * @note Maximum relative error for positive normal doubles (measured over
+ * 20 million random ones):
+ * 0 iterations: 3.44e-2, 1: 1.76e-3, 2: 4.7e-6, 3: 3.2e-11,
+ * 4 or more: 3.3e-16
+ * @param number
+ * @param newtonIterations how much to refine the magic number guess; double
+ * has ~ twice the digits, so the default is 2
+ * @return constexpr double
+ */
+static constexpr inline double FastInverseSquareRoot
+(
+    double number,
+    const std::size_t newtonIterations = FastInverseSquareRootIterations<double>
+)
+{
+    const double halfOfNumber = number * 0.5;
 
-    // double has ~ twice the digits, perform 2 iterations of newton's method
-    number *= threehalfs - (halfOfNumber * number * number);
-    number *= threehalfs - (halfOfNumber * number * number);
+    number = FastInverseSquareRootSeed(number);
+    for (std::size_t iteration = 0; iteration < newtonIterations; ++iteration)
+    {
+        number = FastInverseSquareRootStep(halfOfNumber, number);
+    }
 
     return number;
 }
 
 /**
  * @brief Fast inverse square root approximation
- * 
- * @param number 
- * @return constexpr double 
+ * @details
+ * There is no magic number trick for the x87 80 bit format (its mantissa
+ * has an explicit leading bit), so the guess comes from the double magic
+ * number. Numbers outside of double's range are first scaled by a power of
+ * 4, which scales the result by the matching power of 2 exactly.
+ *
+ * Unlike the float and double versions, this one also gives the right
+ * answer for 0 (infinity), infinity (0) and negative numbers or NaN (NaN).
+ *
+ * The x87 unit has a hardware square root, so at full precision this is
+ * still about twice as slow as 1 / std::sqrt (see `make bench`); it is
+ * here for constant expressions and for when fewer digits are enough.
+ * @note Maximum relative error for positive long doubles (measured over
+ * 20 million random ones):
+ * 0 iterations: 3.44e-2, 1: 1.76e-3, 2: 4.7e-6, 3: 3.2e-11,
+ * 4 or more: 2.1e-19 (about 2 units in the last place)
+ * @param number
+ * @param newtonIterations how much to refine the magic number guess
+ * @return constexpr long double
  */
-static constexpr inline long double FastInverseSquareRoot(long double number)
+static constexpr inline long double FastInverseSquareRoot
+(
+    long double number,
+    const std::size_t newtonIterations =
+        FastInverseSquareRootIterations<long double>
+)
 {
-    //TODO #15 implement fast inverse square root for long double.
-    return std::pow(std::sqrt(number), -1);
+    using Limits = std::numeric_limits<long double>;
+
+    if (!(number > 0))
+    {
+        return number == 0 ? Limits::infinity() : Limits::quiet_NaN();
+    }
+    if (number == Limits::infinity())
+    {
+        return 0;
+    }
+
+    long double scale = 1;
+    using DoubleLimits = std::numeric_limits<double>;
+    if constexpr (Limits::max_exponent > DoubleLimits::max_exponent)
+    {
+        // 1 / sqrt(number * 2^-2000) * 2^-1000 == 1 / sqrt(number)
+        while (number > 0x1p1000L)
+        {
+            number *= 0x1p-2000L;
+            scale *= 0x1p-1000L;
+        }
+        while (number < 0x1p-1000L)
+        {
+            number *= 0x1p2000L;
+            scale *= 0x1p1000L;
+        }
+    }
+
+    const long double halfOfNumber = number * 0.5l;
+
+    // up to 3 iterations only need double's digits, and doubles are a lot
+    // cheaper than the x87 stack
+    const std::size_t doubleIterations =
+        newtonIterations < 3 ? newtonIterations : 3;
+    number = FastInverseSquareRoot((double)number, doubleIterations);
+    for
+    (
+        std::size_t iteration = doubleIterations;
+        iteration < newtonIterations;
+        ++iteration
+    )
+    {
+        number = FastInverseSquareRootStep(halfOfNumber, number);
+    }
+
+    return number * scale;
 }
-#endif
\ No newline at end of file
+#endif
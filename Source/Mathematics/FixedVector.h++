@@ -0,0 +1,601 @@
+/**
+ * @file FixedVector.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines FixedVector, VectorBase's lightweight cousin whose
+ * dimensions and formatting are template parameters
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef FixedVectorFile
+#define FixedVectorFile
+
+#include "Tensor.h++"
+#include "FastInverseSquareRoots.h++"
+#include "../Concepts/Concepts.h++"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace FluidEngine
+{
+    namespace Mathematics
+    {
+        /**
+         * @brief Square root that also works at compile time
+         * @details At runtime this is std::sqrt. While constant evaluating,
+         * it uses Newton's method instead, which lands on the correctly
+         * rounded result or one ulp away from it.
+         * @author Joshua Buchanan
+         * @tparam Floating
+         * @param number must not be negative
+         * @return constexpr Floating
+         */
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        constexpr Floating ConstexprSquareRoot(const Floating& number) noexcept
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return std::sqrt(number);
+            }
+
+            if (number == 0 || number != number ||
+                number == std::numeric_limits<Floating>::infinity())
+            {
+                return number;
+            }
+
+            // starting above the root, Newton's method only ever goes down,
+            // so stop as soon as it doesn't
+            Floating current = number < 1 ? 1 : number;
+            while (true)
+            {
+                const Floating next = (current + number / current) / 2;
+                if (next >= current)
+                {
+                    return current;
+                }
+                current = next;
+            }
+        }
+
+        /**
+         * @brief A vector whose dimensions and formatting are known at
+         * compile time.
+         * @details
+         * VectorBase decides at runtime whether it is 2D or 3D and polar or
+         * rectangular, and carries a name, an identification number and a
+         * vtable around. FixedVector is just its coordinates: it is exactly
+         * Size * sizeof(Floating) bytes, trivially copyable, usable in
+         * constexpr code and every operation is picked at compile time
+         * (no tags to check, no NaN in a missing third coordinate).
+         *
+         * The math is the same as VectorBase's, so converting back and
+         * forth (explicitly) gives the same results as doing everything in
+         * VectorBase.
+         * @author Joshua Buchanan
+         * @tparam Floating float, double or long double
+         * @tparam Dimensions D2 or D3
+         * @tparam Formatting Rct or Plr
+         */
+        template
+        <
+            FluidEngine::Concepts::UsableInVectorBase Floating,
+            VectorDimensions Dimensions,
+            VectorFormatting Formatting
+        >
+        struct FixedVector
+        {
+            using VectorType = Floating;
+
+            /**
+             * @brief How many coordinates there are
+             *
+             */
+            static constexpr std::size_t Size =
+                Dimensions == VectorDimensions::D3 ? 3 : 2;
+
+            static constexpr VectorDimensions dimensions = Dimensions;
+            static constexpr VectorFormatting formatting = Formatting;
+
+            /**
+             * @brief x, y(, z) or r, theta(, phi)
+             *
+             */
+            std::array<VectorType, Size> coordinates;
+
+            /**
+             * @brief Construct a new zero Fixed Vector object
+             * @author Joshua Buchanan
+             */
+            constexpr FixedVector() noexcept
+            : coordinates{}
+            {
+                /*left blank*/
+            }
+
+            /**
+             * @brief Construct a new 2 dimensional Fixed Vector object
+             * @author Joshua Buchanan
+             * @param xOrR the x coordinate or the radius
+             * @param yOrΘ the y coordinate or the angle theta
+             */
+            constexpr FixedVector
+            (
+                const VectorType& xOrR,
+                const VectorType& yOrΘ
+            ) noexcept
+            requires (Dimensions == VectorDimensions::D2)
+            : coordinates{xOrR, yOrΘ}
+            {
+                /*left blank*/
+            }
+
+            /**
+             * @brief Construct a new 3 dimensional Fixed Vector object
+             * @author Joshua Buchanan
+             * @param xOrR the x coordinate or the radius
+             * @param yOrΘ the y coordinate or the angle theta
+             * @param zOrϕ the z coordinate or the angle phi
+             */
+            constexpr FixedVector
+            (
+                const VectorType& xOrR,
+                const VectorType& yOrΘ,
+                const VectorType& zOrϕ
+            ) noexcept
+            requires (Dimensions == VectorDimensions::D3)
+            : coordinates{xOrR, yOrΘ, zOrϕ}
+            {
+                /*left blank*/
+            }
+
+            /**
+             * @brief Converts a VectorBase into a FixedVector, converting
+             * its formatting and dimensions on the way if they differ.
+             * @note A missing third coordinate becomes 0.
+             * @author Joshua Buchanan
+             * @param vector
+             */
+            explicit FixedVector(const VectorBase<VectorType>& vector)
+            noexcept
+            : coordinates{}
+            {
+                const VectorBase<VectorType> formatted =
+                    vector.GetFormatting() == Formatting ? vector :
+                    Formatting == VectorFormatting::Rct ?
+                        vector.AsRectangular() : vector.AsPolar();
+
+                for (std::size_t index = 0; index < Size; ++index)
+                {
+                    this->coordinates[index] =
+                        formatted.GetCoordinates()[index];
+                }
+                if constexpr (Size == 3)
+                {
+                    if (formatted.GetDimensions() == VectorDimensions::D2)
+                    {
+                        this->coordinates[2] = 0;
+                    }
+                }
+            }
+
+            /**
+             * @brief Converts this into a VectorBase with the given name
+             * @author Joshua Buchanan
+             * @param name the reference name of the VectorBase
+             * @return VectorBase<VectorType>
+             */
+            VectorBase<VectorType> ToVectorBase
+            (
+                const std::wstring& name = L"Unnamed Vector"
+            ) const noexcept
+            {
+                return VectorBase<VectorType>
+                (
+                    name,
+                    Dimensions,
+                    Formatting,
+                    this->coordinates[0],
+                    this->coordinates[1],
+                    Size == 3 ?
+                        this->coordinates[Size - 1] :
+                        std::numeric_limits<VectorType>::quiet_NaN()
+                );
+            }
+
+            /**
+             * @brief Converts this into an unnamed VectorBase
+             * @author Joshua Buchanan
+             * @return VectorBase<VectorType>
+             */
+            explicit operator VectorBase<VectorType>() const noexcept
+            {
+                return this->ToVectorBase();
+            }
+
+            /**
+             * @brief Calculates the magnitude, like VectorBase::Magnitude
+             * (squared length for rectangular vectors, r for polar ones)
+             * @author Joshua Buchanan
+             * @return constexpr VectorType
+             */
+            constexpr VectorType Magnitude() const noexcept
+            {
+                if constexpr (Formatting == VectorFormatting::Plr)
+                {
+                    return this->coordinates[0];
+                }
+                else if constexpr (Size == 3)
+                {
+                    return this->coordinates[0] * this->coordinates[0] +
+                           this->coordinates[1] * this->coordinates[1] +
+                           this->coordinates[2] * this->coordinates[2];
+                }
+                else
+                {
+                    return this->coordinates[0] * this->coordinates[0] +
+                           this->coordinates[1] * this->coordinates[1];
+                }
+            }
+
+            /**
+             * @brief Normalizes this with exact precision, like
+             * VectorBase::NormalizedForm
+             * @author Joshua Buchanan
+             * @return constexpr FixedVector
+             */
+            constexpr FixedVector NormalizedForm() const noexcept
+            {
+                FixedVector normalized = *this;
+                if constexpr (Formatting == VectorFormatting::Plr)
+                {
+                    normalized.coordinates[0] = 1;
+                }
+                else
+                {
+                    const VectorType length = ConstexprSquareRoot
+                    (
+                        this->Magnitude()
+                    );
+                    for (std::size_t index = 0; index < Size; ++index)
+                    {
+                        normalized.coordinates[index] /= length;
+                    }
+                }
+                return normalized;
+            }
+
+            /**
+             * @brief Approximately normalizes this using voodoo math, like
+             * VectorBase::FastNormalize
+             * @author Joshua Buchanan
+             * @return constexpr FixedVector
+             */
+            constexpr FixedVector FastNormalize() const noexcept
+            {
+                FixedVector normalized = *this;
+                if constexpr (Formatting == VectorFormatting::Plr)
+                {
+                    normalized.coordinates[0] = 1;
+                }
+                else
+                {
+                    const VectorType multiplicationFactor =
+                        FastInverseSquareRoot(this->Magnitude());
+                    for (std::size_t index = 0; index < Size; ++index)
+                    {
+                        normalized.coordinates[index] *= multiplicationFactor;
+                    }
+                }
+                return normalized;
+            }
+
+            /**
+             * @brief Converts this to polar form, like VectorBase::AsPolar
+             * @author Joshua Buchanan
+             * @return FixedVector<VectorType, Dimensions, VectorFormatting::Plr>
+             */
+            FixedVector<VectorType, Dimensions, VectorFormatting::Plr>
+            AsPolar() const noexcept
+            {
+                if constexpr (Formatting == VectorFormatting::Plr)
+                {
+                    return *this;
+                }
+                else
+                {
+                    const FixedVector normalized = this->NormalizedForm();
+                    FixedVector<VectorType, Dimensions, VectorFormatting::Plr>
+                        polar;
+
+                    polar.coordinates[0] = this->Magnitude();
+                    // see VectorBase::AsPolar for where these come from
+                    if constexpr (Size == 3)
+                    {
+                        polar.coordinates[1] = std::asin
+                        (
+                            std::sqrt
+                            (
+                                std::hypot
+                                (
+                                    normalized.coordinates[0],
+                                    normalized.coordinates[1]
+                                )
+                            )
+                        );
+                        polar.coordinates[2] = std::atan
+                        (
+                            normalized.coordinates[2] /
+                            normalized.coordinates[0]
+                        );
+                    }
+                    else
+                    {
+                        polar.coordinates[1] = std::asin
+                        (
+                            normalized.coordinates[1]
+                        );
+                    }
+                    return polar;
+                }
+            }
+
+            /**
+             * @brief Converts this to rectangular form, like
+             * VectorBase::AsRectangular
+             * @author Joshua Buchanan
+             * @return FixedVector<VectorType, Dimensions, VectorFormatting::Rct>
+             */
+            FixedVector<VectorType, Dimensions, VectorFormatting::Rct>
+            AsRectangular() const noexcept
+            {
+                if constexpr (Formatting == VectorFormatting::Rct)
+                {
+                    return *this;
+                }
+                else
+                {
+                    FixedVector<VectorType, Dimensions, VectorFormatting::Rct>
+                        rectangular;
+
+                    const VectorType r = this->coordinates[0];
+                    const VectorType Θ = this->coordinates[1];
+
+                    rectangular.coordinates[0] = r * std::cos(Θ);
+                    rectangular.coordinates[1] = r * std::sin(Θ);
+                    if constexpr (Size == 3)
+                    {
+                        const VectorType ϕ = this->coordinates[2];
+                        const VectorType phiFactor = std::cos(ϕ);
+
+                        rectangular.coordinates[0] *= phiFactor;
+                        rectangular.coordinates[1] *= phiFactor;
+                        rectangular.coordinates[2] =
+                            r * std::sin(Θ) * std::sin(ϕ);
+                    }
+                    return rectangular;
+                }
+            }
+
+            /**
+             * @brief Expands this to three dimensions with the given third
+             * coordinate (which is either z or phi).
+             * @author Joshua Buchanan
+             * @param thirdCoordinate value of the z or phi coordinate
+             * @return constexpr FixedVector<VectorType, VectorDimensions::D3, Formatting>
+             */
+            constexpr FixedVector<VectorType, VectorDimensions::D3, Formatting>
+            ExpandToThreeDimensions
+            (
+                const VectorType& thirdCoordinate = 0
+            ) const noexcept
+            requires (Dimensions == VectorDimensions::D2)
+            {
+                return FixedVector
+                <
+                    VectorType,
+                    VectorDimensions::D3,
+                    Formatting
+                >
+                (
+                    this->coordinates[0],
+                    this->coordinates[1],
+                    thirdCoordinate
+                );
+            }
+
+            /**
+             * @brief Drops the third coordinate
+             * @author Joshua Buchanan
+             * @return constexpr FixedVector<VectorType, VectorDimensions::D2, Formatting>
+             */
+            constexpr FixedVector<VectorType, VectorDimensions::D2, Formatting>
+            CompressToTwoDimensions() const noexcept
+            requires (Dimensions == VectorDimensions::D3)
+            {
+                return FixedVector
+                <
+                    VectorType,
+                    VectorDimensions::D2,
+                    Formatting
+                >
+                (
+                    this->coordinates[0],
+                    this->coordinates[1]
+                );
+            }
+
+            /**
+             * @brief Adds coordinate by coordinate
+             * @author Joshua Buchanan
+             * @return constexpr FixedVector
+             */
+            constexpr FixedVector operator+(const FixedVector& other)
+            const noexcept
+            {
+                FixedVector sum = *this;
+                for (std::size_t index = 0; index < Size; ++index)
+                {
+                    sum.coordinates[index] += other.coordinates[index];
+                }
+                return sum;
+            }
+
+            /**
+             * @brief Subtracts coordinate by coordinate
+             * @author Joshua Buchanan
+             * @return constexpr FixedVector
+             */
+            constexpr FixedVector operator-(const FixedVector& other)
+            const noexcept
+            {
+                FixedVector difference = *this;
+                for (std::size_t index = 0; index < Size; ++index)
+                {
+                    difference.coordinates[index] -= other.coordinates[index];
+                }
+                return difference;
+            }
+
+            /**
+             * @brief Multiplies coordinate by coordinate
+             * @author Joshua Buchanan
+             * @return constexpr FixedVector
+             */
+            constexpr FixedVector operator*(const FixedVector& other)
+            const noexcept
+            {
+                FixedVector product = *this;
+                for (std::size_t index = 0; index < Size; ++index)
+                {
+                    product.coordinates[index] *= other.coordinates[index];
+                }
+                return product;
+            }
+
+            /**
+             * @brief Divides coordinate by coordinate
+             * @author Joshua Buchanan
+             * @return constexpr FixedVector
+             */
+            constexpr FixedVector operator/(const FixedVector& other)
+            const noexcept
+            {
+                FixedVector quotient = *this;
+                for (std::size_t index = 0; index < Size; ++index)
+                {
+                    quotient.coordinates[index] /= other.coordinates[index];
+                }
+                return quotient;
+            }
+
+            /**
+             * @brief Reflects this about a unit normal: d - 2 (d . n) n
+             * @note Same math as VectorBatch::Reflection
+             * @author Joshua Buchanan
+             * @param normal unit normal of the reflecting surface
+             * @return constexpr FixedVector
+             */
+            constexpr FixedVector Reflection(const FixedVector& normal)
+            const noexcept
+            requires (Formatting == VectorFormatting::Rct)
+            {
+                // same order as the batch kernels
+                VectorType dot =
+                    this->coordinates[0] * normal.coordinates[0] +
+                    this->coordinates[1] * normal.coordinates[1];
+                if constexpr (Size == 3)
+                {
+                    dot = dot + this->coordinates[2] * normal.coordinates[2];
+                }
+
+                const VectorType scale = 2 * dot;
+                FixedVector reflected = *this;
+                for (std::size_t index = 0; index < Size; ++index)
+                {
+                    reflected.coordinates[index] -=
+                        scale * normal.coordinates[index];
+                }
+                return reflected;
+            }
+
+            /**
+             * @brief Coordinate by coordinate equality
+             *
+             */
+            constexpr bool operator==(const FixedVector&) const noexcept =
+                default;
+        };
+
+        /**
+         * @brief 2 dimensional rectangular FixedVector
+         *
+         * @tparam Floating
+         */
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        using RectangularVector2 = FixedVector
+        <
+            Floating, VectorDimensions::D2, VectorFormatting::Rct
+        >;
+
+        /**
+         * @brief 3 dimensional rectangular FixedVector
+         *
+         * @tparam Floating
+         */
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        using RectangularVector3 = FixedVector
+        <
+            Floating, VectorDimensions::D3, VectorFormatting::Rct
+        >;
+
+        /**
+         * @brief 2 dimensional polar FixedVector
+         *
+         * @tparam Floating
+         */
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        using PolarVector2 = FixedVector
+        <
+            Floating, VectorDimensions::D2, VectorFormatting::Plr
+        >;
+
+        /**
+         * @brief 3 dimensional polar FixedVector
+         *
+         * @tparam Floating
+         */
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        using PolarVector3 = FixedVector
+        <
+            Floating, VectorDimensions::D3, VectorFormatting::Plr
+        >;
+
+        static_assert
+        (
+            sizeof(RectangularVector3<float>) == 3 * sizeof(float) &&
+            sizeof(RectangularVector2<double>) == 2 * sizeof(double) &&
+            sizeof(PolarVector3<long double>) == 3 * sizeof(long double),
+            "FixedVector must be nothing but its coordinates"
+        );
+        static_assert
+        (
+            std::is_trivially_copyable<RectangularVector3<float>>::value &&
+            std::is_trivially_copyable<PolarVector2<double>>::value,
+            "FixedVector must be trivially copyable"
+        );
+
+    } // namespace Mathematics
+
+} // namespace FluidEngine
+
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * @file InstructionSets.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for InstructionSets.h++
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "InstructionSets.h++"
+
+#include <atomic>
+
+using namespace FluidEngine::Mathematics;
+
+/**
+ * @brief Asks the CPU what it can do
+ * @author Joshua Buchanan
+ * @return InstructionSet
+ */
+static InstructionSet QueryInstructionSet() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return InstructionSet::AVX2;
+    }
+    if (__builtin_cpu_supports("sse2"))
+    {
+        return InstructionSet::SSE2;
+    }
+#endif
+    return InstructionSet::Scalar;
+}
+
+/**
+ * @brief The instruction set the batch kernels dispatch to
+ *
+ */
+static std::atomic<InstructionSet> activeInstructionSet =
+    DetectInstructionSet();
+
+const InstructionSet& FluidEngine::Mathematics::DetectInstructionSet()
+noexcept
+{
+    static const InstructionSet detected = QueryInstructionSet();
+    return detected;
+}
+
+InstructionSet FluidEngine::Mathematics::ActiveInstructionSet() noexcept
+{
+    return activeInstructionSet.load(std::memory_order_relaxed);
+}
+
+FluidEngine::Abstraction::Acknowledgement
+FluidEngine::Mathematics::ForceInstructionSet
+(
+    const InstructionSet& instructionSet
+) noexcept
+{
+    // the enum is ordered by capability, so anything at or below what we
+    // detected is fair game
+    if (instructionSet > DetectInstructionSet())
+    {
+        return Abstraction::Acknowledgement::Failure;
+    }
+
+    activeInstructionSet.store(instructionSet, std::memory_order_relaxed);
+    return Abstraction::Acknowledgement::Success;
+}
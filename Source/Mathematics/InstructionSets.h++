@@ -0,0 +1,80 @@
+/**
+ * @file InstructionSets.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Runtime detection of the SIMD instruction sets the batch kernels use
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef InstructionSetsFile
+#define InstructionSetsFile
+
+#include "../Abstraction/FluidEngineMember.h++"
+
+namespace FluidEngine
+{
+    namespace Mathematics
+    {
+        /**
+         * @brief The SIMD instruction sets the batch kernels know about,
+         * from least to most capable
+         * @author Joshua Buchanan
+         */
+        enum class InstructionSet
+        {
+            /**
+             * @brief Plain C++, one element at a time
+             * @author Joshua Buchanan
+             */
+            Scalar,
+            /**
+             * @brief 128 bit vectors (4 floats / 2 doubles)
+             * @author Joshua Buchanan
+             */
+            SSE2,
+            /**
+             * @brief 256 bit vectors (8 floats / 4 doubles)
+             * @author Joshua Buchanan
+             */
+            AVX2,
+        };
+
+        /**
+         * @brief Gets the most capable instruction set this CPU supports.
+         * @note Checked once, then cached.
+         * @author Joshua Buchanan
+         * @return const InstructionSet&
+         */
+        const InstructionSet& DetectInstructionSet() noexcept;
+
+        /**
+         * @brief Gets the instruction set the batch kernels currently use.
+         * Defaults to DetectInstructionSet().
+         * @author Joshua Buchanan
+         * @return InstructionSet
+         */
+        InstructionSet ActiveInstructionSet() noexcept;
+
+        /**
+         * @brief Makes the batch kernels use the given instruction set.
+         * @note Mostly for tests and benchmarks that compare a SIMD path
+         * against the scalar one.
+         * @author Joshua Buchanan
+         * @param instructionSet the instruction set to use
+         * @return Abstraction::Acknowledgement Failure if this CPU does not
+         * support instructionSet (nothing changes in that case)
+         */
+        Abstraction::Acknowledgement ForceInstructionSet
+        (
+            const InstructionSet& instructionSet
+        ) noexcept;
+
+    } // namespace Mathematics
+
+} // namespace FluidEngine
+
+
+#endif
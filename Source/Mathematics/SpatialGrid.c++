@@ -0,0 +1,819 @@
+/**
+ * @file SpatialGrid.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for SpatialGrid.h++
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "SpatialGrid.h++"
+
+#include "../Diagnostics/Instrumentation.h++"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+using namespace FluidEngine::Mathematics;
+using FluidEngine::Abstraction::Acknowledgement;
+using FluidEngine::Concurrency::JobSystem;
+using FluidEngine::Concurrency::Range;
+
+/**
+ * @brief Constructs an empty SpatialGrid
+ * @author Joshua Buchanan
+ * @param gridName the name of the grid
+ * @param dimensions the dimensions of the positions it will hold
+ * @param cellSize how big its cells should be; the radius of the usual
+ * query is a good choice
+ *
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+SpatialGrid<Precision>::SpatialGrid
+(
+    const std::wstring& gridName,
+    const VectorDimensions& dimensions,
+    const Precision& cellSize
+) noexcept
+: Abstraction::FluidEngineMember(gridName),
+  dimensions(dimensions),
+  cellSize(cellSize),
+  spacing(cellSize),
+  inverseSpacing(1 / cellSize),
+  slack(0),
+  lower{0, 0, 0},
+  upper{0, 0, 0},
+  cellCounts{1, 1, 1},
+  cellStarts{0, 0}
+{
+    /*Intentionally left blank*/
+}
+
+/**
+ * @brief Constructs an empty SpatialGrid
+ * @author Joshua Buchanan
+ * @param dimensions the dimensions of the positions it will hold
+ * @param cellSize how big its cells should be; the radius of the usual
+ * query is a good choice
+ *
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+SpatialGrid<Precision>::SpatialGrid
+(
+    const VectorDimensions& dimensions,
+    const Precision& cellSize
+) noexcept
+: SpatialGrid(L"Unnamed Spatial Grid", dimensions, cellSize)
+{
+    /*Intentionally left blank*/
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::size_t SpatialGrid<Precision>::CellAlong
+(
+    const std::size_t& axis,
+    const Precision& coordinate
+) const noexcept
+{
+    const Precision offset = (coordinate - this->lower[axis]) *
+        this->inverseSpacing;
+    // !(offset > 0) also catches NaN
+    if (!(offset > 0))
+    {
+        return 0;
+    }
+    if (offset >= (Precision)this->cellCounts[axis])
+    {
+        return this->cellCounts[axis] - 1;
+    }
+    return (std::size_t)offset;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Precision SpatialGrid<Precision>::DistanceSquared
+(
+    const std::array<Precision, 3>& point,
+    const std::size_t& slot
+) const noexcept
+{
+    // the same operations, in the same order, as (a - b).Magnitude()
+    const Precision x = this->sorted[0][slot] - point[0];
+    const Precision y = this->sorted[1][slot] - point[1];
+    const Precision z = this->sorted[2][slot] - point[2];
+    return x * x + y * y + z * z;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SpatialGrid<Precision>::Locate
+(
+    const VectorBatch<Precision>& positions,
+    JobSystem* system
+) noexcept
+{
+    const std::size_t count = positions.Size();
+    const std::size_t axes =
+        this->dimensions == VectorDimensions::D3 ? 3 : 2;
+
+    if
+    (
+        positions.GetDimensions() != this->dimensions ||
+        positions.GetFormatting() != VectorFormatting::Rct ||
+        !(this->cellSize > 0) ||
+        !std::isfinite(this->cellSize) ||
+        count > (std::numeric_limits<std::uint32_t>::max() - 64) /
+            cellsPerParticle
+    )
+    {
+        return Acknowledgement::Failure;
+    }
+
+    struct Bounds
+    {
+        std::array<Precision, 3> lower;
+        std::array<Precision, 3> upper;
+        bool finite;
+    };
+    const Bounds none =
+    {
+        {
+            std::numeric_limits<Precision>::infinity(),
+            std::numeric_limits<Precision>::infinity(),
+            std::numeric_limits<Precision>::infinity()
+        },
+        {
+            -std::numeric_limits<Precision>::infinity(),
+            -std::numeric_limits<Precision>::infinity(),
+            -std::numeric_limits<Precision>::infinity()
+        },
+        true
+    };
+    const auto bound = [&](const Range& chunk)
+    {
+        Bounds bounds = none;
+        for (std::size_t axis = 0; axis < axes; ++axis)
+        {
+            const std::span<const Precision> column =
+                positions.GetColumn(axis);
+            for (std::size_t index = chunk.begin; index < chunk.end; ++index)
+            {
+                const Precision& coordinate = column[index];
+                bounds.finite = bounds.finite && std::isfinite(coordinate);
+                bounds.lower[axis] = std::min(bounds.lower[axis], coordinate);
+                bounds.upper[axis] = std::max(bounds.upper[axis], coordinate);
+            }
+        }
+        return bounds;
+    };
+    const auto combine = [axes](Bounds lhs, const Bounds& rhs)
+    {
+        for (std::size_t axis = 0; axis < axes; ++axis)
+        {
+            lhs.lower[axis] = std::min(lhs.lower[axis], rhs.lower[axis]);
+            lhs.upper[axis] = std::max(lhs.upper[axis], rhs.upper[axis]);
+        }
+        lhs.finite = lhs.finite && rhs.finite;
+        return lhs;
+    };
+    const Bounds bounds = system == nullptr ?
+        bound({0, count}) :
+        system->ParallelReduce({0, count}, buildGrain, none, bound, combine);
+    if (!bounds.finite)
+    {
+        return Acknowledgement::Failure;
+    }
+
+    this->spacing = this->cellSize;
+    this->cellCounts = {1, 1, 1};
+    if (count == 0)
+    {
+        this->lower = {0, 0, 0};
+        this->upper = {0, 0, 0};
+        this->inverseSpacing = 1 / this->spacing;
+        this->slack = 0;
+        this->cells.clear();
+        return Acknowledgement::Success;
+    }
+    this->lower = bounds.lower;
+    this->upper = bounds.upper;
+    if (axes == 2)
+    {
+        this->lower[2] = 0;
+        this->upper[2] = 0;
+    }
+
+    // positions further apart than the largest Precision would overflow
+    // every offset from lower
+    std::array<Precision, 3> extents = {0, 0, 0};
+    for (std::size_t axis = 0; axis < axes; ++axis)
+    {
+        extents[axis] = this->upper[axis] - this->lower[axis];
+        if (!std::isfinite(extents[axis]))
+        {
+            return Acknowledgement::Failure;
+        }
+    }
+
+    // too many cells cost more to go through than they save, so a sparse
+    // set of positions gets bigger cells
+    const long double cellLimit =
+        (long double)(cellsPerParticle * count + 64);
+    for (;;)
+    {
+        this->inverseSpacing = 1 / this->spacing;
+        // growing can only run away if something above overflowed
+        if (!std::isfinite(this->spacing) || !(this->inverseSpacing > 0))
+        {
+            this->spacing = this->cellSize;
+            this->inverseSpacing = 1 / this->spacing;
+            return Acknowledgement::Failure;
+        }
+        long double cellCount = 1;
+        for (std::size_t axis = 0; axis < axes; ++axis)
+        {
+            cellCount *= std::floor
+            (
+                (long double)(extents[axis] * this->inverseSpacing)
+            ) + 1;
+        }
+        if (cellCount <= cellLimit)
+        {
+            break;
+        }
+        this->spacing *= (Precision)std::pow
+        (
+            cellCount / cellLimit,
+            1.0l / axes
+        ) * (Precision)1.01;
+    }
+
+    Precision widest = 0;
+    for (std::size_t axis = 0; axis < axes; ++axis)
+    {
+        const Precision extent = extents[axis] * this->inverseSpacing;
+        this->cellCounts[axis] = (std::size_t)extent + 1;
+        widest = std::max(widest, extent);
+    }
+    // how far, in cells, rounding may have put a particle from its cell
+    this->slack = 4 * std::numeric_limits<Precision>::epsilon() *
+        (widest + 1);
+
+    this->cells.resize(count);
+    const auto locate = [&](const Range& chunk)
+    {
+        for (std::size_t index = chunk.begin; index < chunk.end; ++index)
+        {
+            std::size_t cell = 0;
+            for (std::size_t axis = axes; axis-- > 0;)
+            {
+                cell = cell * this->cellCounts[axis] + this->CellAlong
+                (
+                    axis,
+                    positions.GetColumn(axis)[index]
+                );
+            }
+            this->cells[index] = (std::uint32_t)cell;
+        }
+    };
+    if (system == nullptr)
+    {
+        locate({0, count});
+    }
+    else
+    {
+        system->ParallelFor({0, count}, buildGrain, locate);
+    }
+    return Acknowledgement::Success;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void SpatialGrid<Precision>::Sort
+(
+    const VectorBatch<Precision>& positions,
+    JobSystem* system
+) noexcept
+{
+    const std::size_t count = this->cells.size();
+    const std::size_t axes =
+        this->dimensions == VectorDimensions::D3 ? 3 : 2;
+
+    // count, sum up to where every cell ends, then hand out slots from the
+    // back, which leaves every cell's start behind and keeps particles of
+    // a cell in index order
+    this->cellStarts.assign(this->CellCount() + 1, 0);
+    for (const std::uint32_t& cell : this->cells)
+    {
+        ++this->cellStarts[cell];
+    }
+    std::uint32_t end = 0;
+    for (std::uint32_t& start : this->cellStarts)
+    {
+        end += start;
+        start = end;
+    }
+    this->slots.resize(count);
+    for (std::size_t index = count; index-- > 0;)
+    {
+        this->slots[index] = --this->cellStarts[this->cells[index]];
+    }
+
+    this->particles.resize(count);
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        this->sorted[axis].resize(count);
+    }
+    if (axes == 2)
+    {
+        std::fill(this->sorted[2].begin(), this->sorted[2].end(), 0);
+    }
+    const auto scatter = [&](const Range& chunk)
+    {
+        for (std::size_t index = chunk.begin; index < chunk.end; ++index)
+        {
+            const std::uint32_t slot = this->slots[index];
+            this->particles[slot] = (std::uint32_t)index;
+            for (std::size_t axis = 0; axis < axes; ++axis)
+            {
+                this->sorted[axis][slot] = positions.GetColumn(axis)[index];
+            }
+        }
+    };
+    if (system == nullptr)
+    {
+        scatter({0, count});
+    }
+    else
+    {
+        system->ParallelFor({0, count}, buildGrain, scatter);
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void SpatialGrid<Precision>::Resort
+(
+    const VectorBatch<Precision>& positions
+) noexcept
+{
+    const std::size_t axes =
+        this->dimensions == VectorDimensions::D3 ? 3 : 2;
+
+    // a particle moving from one cell to another shifts the slots of every
+    // cell in between, and nothing outside them; overlapping runs of cells
+    // are merged so that each run keeps its particles
+    this->runs.clear();
+    for (const Move& move : this->moves)
+    {
+        const std::uint32_t to = this->cells[move.particle];
+        this->runs.push_back
+        (
+            {std::min(move.from, to), std::max(move.from, to)}
+        );
+    }
+    std::sort(this->runs.begin(), this->runs.end());
+    std::size_t runCount = 0;
+    for (const auto& run : this->runs)
+    {
+        if (runCount > 0 && run.first <= this->runs[runCount - 1].second)
+        {
+            this->runs[runCount - 1].second =
+                std::max(this->runs[runCount - 1].second, run.second);
+        }
+        else
+        {
+            this->runs[runCount++] = run;
+        }
+    }
+    this->runs.resize(runCount);
+
+    // within a cell particles are in index order, so the moved ones, sorted
+    // by (cell, index), merge with the ones that stayed
+    const auto before = [this](const std::uint32_t& lhs,
+        const std::uint32_t& rhs)
+    {
+        return this->cells[lhs] < this->cells[rhs] ||
+            (this->cells[lhs] == this->cells[rhs] && lhs < rhs);
+    };
+    std::sort(this->moves.begin(), this->moves.end(),
+        [&before](const Move& lhs, const Move& rhs)
+        {
+            return before(lhs.particle, rhs.particle);
+        });
+
+    std::size_t next = 0;
+    for (const auto& [first, last] : this->runs)
+    {
+        const std::uint32_t start = this->cellStarts[first];
+        const std::uint32_t end = this->cellStarts[last + 1];
+
+        this->reordered.clear();
+        for (std::uint32_t cell = first; cell <= last; ++cell)
+        {
+            for (std::uint32_t slot = this->cellStarts[cell];
+                slot < this->cellStarts[cell + 1]; ++slot)
+            {
+                const std::uint32_t particle = this->particles[slot];
+                // it left this cell, and comes in with the moved ones
+                if (this->cells[particle] != cell)
+                {
+                    continue;
+                }
+                while
+                (
+                    next < this->moves.size() &&
+                    before(this->moves[next].particle, particle)
+                )
+                {
+                    this->reordered.push_back(this->moves[next++].particle);
+                }
+                this->reordered.push_back(particle);
+            }
+        }
+        while
+        (
+            next < this->moves.size() &&
+            this->cells[this->moves[next].particle] <= last
+        )
+        {
+            this->reordered.push_back(this->moves[next++].particle);
+        }
+
+        // cells before first and after last keep their starts
+        std::uint32_t cell = first;
+        for (std::uint32_t slot = start; slot < end; ++slot)
+        {
+            const std::uint32_t particle = this->reordered[slot - start];
+            while (cell < this->cells[particle])
+            {
+                this->cellStarts[++cell] = slot;
+            }
+            this->particles[slot] = particle;
+            this->slots[particle] = slot;
+            for (std::size_t axis = 0; axis < axes; ++axis)
+            {
+                this->sorted[axis][slot] = positions.GetColumn(axis)[particle];
+            }
+        }
+        while (cell < last)
+        {
+            this->cellStarts[++cell] = end;
+        }
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SpatialGrid<Precision>::Build
+(
+    const VectorBatch<Precision>& positions,
+    JobSystem* system
+) noexcept
+{
+    FluidEngineZone("SpatialGrid::Build");
+
+    if (this->Locate(positions, system) == Acknowledgement::Failure)
+    {
+        this->cellCounts = {1, 1, 1};
+        this->cells.clear();
+        this->Sort(positions, nullptr);
+        return Acknowledgement::Failure;
+    }
+    this->Sort(positions, system);
+    return Acknowledgement::Success;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SpatialGrid<Precision>::Build
+(
+    const VectorBatch<Precision>& positions
+) noexcept
+{
+    return this->Build(positions, nullptr);
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SpatialGrid<Precision>::Build
+(
+    const VectorBatch<Precision>& positions,
+    JobSystem& system
+) noexcept
+{
+    return this->Build(positions, &system);
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SpatialGrid<Precision>::Build
+(
+    std::span<const VectorBase<Precision>> positions
+) noexcept
+{
+    VectorBatch<Precision> batch
+    (
+        this->dimensions,
+        VectorFormatting::Rct
+    );
+    if (batch.Import(positions) == Acknowledgement::Failure)
+    {
+        // still empties the grid
+        batch = VectorBatch<Precision>
+        (
+            this->dimensions,
+            VectorFormatting::Plr
+        );
+    }
+    return this->Build(batch, nullptr);
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SpatialGrid<Precision>::Update
+(
+    const VectorBatch<Precision>& positions,
+    std::span<const std::size_t> moved
+) noexcept
+{
+    FluidEngineZone("SpatialGrid::Update");
+
+    const std::size_t axes =
+        this->dimensions == VectorDimensions::D3 ? 3 : 2;
+    if
+    (
+        positions.Size() != this->Size() ||
+        positions.GetDimensions() != this->dimensions ||
+        positions.GetFormatting() != VectorFormatting::Rct
+    )
+    {
+        return this->Build(positions, nullptr);
+    }
+    for (const std::size_t& particle : moved)
+    {
+        if (particle >= this->Size())
+        {
+            return Acknowledgement::Failure;
+        }
+    }
+
+    this->moves.clear();
+    for (const std::size_t& particle : moved)
+    {
+        std::size_t cell = 0;
+        for (std::size_t axis = axes; axis-- > 0;)
+        {
+            const Precision& coordinate = positions.GetColumn(axis)[particle];
+            // NaN fails both comparisons, and Build refuses it
+            if
+            (
+                !(coordinate >= this->lower[axis]) ||
+                !(coordinate <= this->upper[axis])
+            )
+            {
+                return this->Build(positions, nullptr);
+            }
+            cell = cell * this->cellCounts[axis] +
+                this->CellAlong(axis, coordinate);
+        }
+
+        if (cell == this->cells[particle])
+        {
+            for (std::size_t axis = 0; axis < axes; ++axis)
+            {
+                this->sorted[axis][this->slots[particle]] =
+                    positions.GetColumn(axis)[particle];
+            }
+        }
+        else
+        {
+            this->moves.push_back
+            (
+                {(std::uint32_t)particle, this->cells[particle]}
+            );
+            this->cells[particle] = (std::uint32_t)cell;
+        }
+    }
+
+    if (this->moves.size() > this->Size() / 8)
+    {
+        this->Sort(positions, nullptr);
+    }
+    else if (!this->moves.empty())
+    {
+        this->Resort(positions);
+    }
+    return Acknowledgement::Success;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::size_t SpatialGrid<Precision>::Size() const noexcept
+{
+    return this->particles.size();
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::size_t SpatialGrid<Precision>::CellCount() const noexcept
+{
+    return this->cellCounts[0] * this->cellCounts[1] * this->cellCounts[2];
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+const Precision& SpatialGrid<Precision>::GetCellSize() const noexcept
+{
+    return this->spacing;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void SpatialGrid<Precision>::FindNeighbors
+(
+    const std::array<Precision, 3>& point,
+    const Precision& radius,
+    std::vector<std::size_t>& neighbors
+) const noexcept
+{
+    neighbors.clear();
+
+    const bool threeDimensional = this->dimensions == VectorDimensions::D3;
+    const std::array<Precision, 3> center =
+    {
+        point[0],
+        point[1],
+        threeDimensional ? point[2] : 0
+    };
+    const Precision reach = radius * radius;
+
+    std::array<std::size_t, 3> from = {0, 0, 0};
+    std::array<std::size_t, 3> to = {0, 0, 0};
+    for (std::size_t axis = 0; axis < (threeDimensional ? 3u : 2u); ++axis)
+    {
+        from[axis] = this->CellAlong(axis, center[axis] - radius);
+        to[axis] = this->CellAlong(axis, center[axis] + radius);
+    }
+
+    for (std::size_t z = from[2]; z <= to[2]; ++z)
+    {
+        for (std::size_t y = from[1]; y <= to[1]; ++y)
+        {
+            // the cells of a row are next to each other, and so are their
+            // particles
+            const std::size_t row =
+                (z * this->cellCounts[1] + y) * this->cellCounts[0];
+            const std::size_t end = this->cellStarts[row + to[0] + 1];
+            for (std::size_t slot = this->cellStarts[row + from[0]];
+                slot < end; ++slot)
+            {
+                if (this->DistanceSquared(center, slot) <= reach)
+                {
+                    neighbors.push_back(this->particles[slot]);
+                }
+            }
+        }
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void SpatialGrid<Precision>::FindNearest
+(
+    const std::array<Precision, 3>& point,
+    const std::size_t& count,
+    std::vector<std::size_t>& nearest
+) const noexcept
+{
+    nearest.clear();
+
+    const bool threeDimensional = this->dimensions == VectorDimensions::D3;
+    const std::size_t axes = threeDimensional ? 3 : 2;
+    const std::array<Precision, 3> center =
+    {
+        point[0],
+        point[1],
+        threeDimensional ? point[2] : 0
+    };
+    const std::size_t wanted = std::min(count, this->Size());
+    if
+    (
+        wanted == 0 ||
+        !std::isfinite(center[0]) ||
+        !std::isfinite(center[1]) ||
+        !std::isfinite(center[2])
+    )
+    {
+        return;
+    }
+
+    // the cell point is in, even when that is outside the grid, and how
+    // many rings out the grid starts
+    using Cell = long long;
+    std::array<Cell, 3> home = {0, 0, 0};
+    std::array<Cell, 3> last = {0, 0, 0};
+    Cell ring = 0;
+    for (std::size_t axis = 0; axis < axes; ++axis)
+    {
+        const Precision offset = std::clamp<Precision>
+        (
+            (center[axis] - this->lower[axis]) * this->inverseSpacing,
+            -(Precision)(1ll << 40),
+            (Precision)(1ll << 40)
+        );
+        home[axis] = (Cell)std::floor(offset);
+        last[axis] = (Cell)this->cellCounts[axis] - 1;
+        ring = std::max({ring, -home[axis], home[axis] - last[axis]});
+    }
+
+    // a max heap of the best so far, worst on top
+    std::vector<std::pair<Precision, std::uint32_t>> best;
+    best.reserve(wanted + 1);
+    const auto visit = [&](const Cell& first, const Cell& final, const Cell& y,
+        const Cell& z)
+    {
+        const std::size_t row =
+            ((std::size_t)z * this->cellCounts[1] + (std::size_t)y) *
+            this->cellCounts[0];
+        const std::size_t end =
+            this->cellStarts[row + (std::size_t)final + 1];
+        for (std::size_t slot = this->cellStarts[row + (std::size_t)first];
+            slot < end; ++slot)
+        {
+            const std::pair<Precision, std::uint32_t> candidate =
+            {
+                this->DistanceSquared(center, slot),
+                this->particles[slot]
+            };
+            if (best.size() < wanted)
+            {
+                best.push_back(candidate);
+                std::push_heap(best.begin(), best.end());
+            }
+            else if (candidate < best.front())
+            {
+                std::pop_heap(best.begin(), best.end());
+                best.back() = candidate;
+                std::push_heap(best.begin(), best.end());
+            }
+        }
+    };
+
+    for (;; ++ring)
+    {
+        std::array<Cell, 3> from = {0, 0, 0};
+        std::array<Cell, 3> to = {0, 0, 0};
+        bool coversGrid = true;
+        for (std::size_t axis = 0; axis < axes; ++axis)
+        {
+            from[axis] = std::max<Cell>(home[axis] - ring, 0);
+            to[axis] = std::min<Cell>(home[axis] + ring, last[axis]);
+            coversGrid = coversGrid && from[axis] == 0 &&
+                to[axis] == last[axis];
+        }
+
+        // only the cells exactly ring cells away; the inside was done
+        for (Cell z = from[2]; z <= to[2]; ++z)
+        {
+            const bool zOnRing =
+                threeDimensional && std::abs(z - home[2]) == ring;
+            for (Cell y = from[1]; y <= to[1]; ++y)
+            {
+                if (zOnRing || std::abs(y - home[1]) == ring)
+                {
+                    visit(from[0], to[0], y, z);
+                    continue;
+                }
+                if (home[0] - ring >= 0 && home[0] - ring <= last[0])
+                {
+                    visit(home[0] - ring, home[0] - ring, y, z);
+                }
+                if (ring > 0 && home[0] + ring >= 0 &&
+                    home[0] + ring <= last[0])
+                {
+                    visit(home[0] + ring, home[0] + ring, y, z);
+                }
+            }
+        }
+
+        if (coversGrid)
+        {
+            break;
+        }
+        // whatever is in the next ring is at least this far away
+        const Precision reach = ((Precision)ring - this->slack) *
+            this->spacing;
+        if (best.size() == wanted && reach > 0 &&
+            best.front().first <= reach * reach)
+        {
+            break;
+        }
+    }
+
+    std::sort_heap(best.begin(), best.end());
+    for (const auto& [distance, particle] : best)
+    {
+        nearest.push_back(particle);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Explicit instantiations, so that the definitions can live in here
+//-----------------------------------------------------------------------------
+
+template class FluidEngine::Mathematics::SpatialGrid<float>;
+template class FluidEngine::Mathematics::SpatialGrid<double>;
+template class FluidEngine::Mathematics::SpatialGrid<long double>;
@@ -0,0 +1,352 @@
+/**
+ * @file SpatialGrid.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines SpatialGrid, a uniform grid over particle positions for
+ * finding neighbors without looking at every pair
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef SpatialGridFile
+#define SpatialGridFile
+
+#include "Tensor.h++"
+#include "VectorBatch.h++"
+#include "../Abstraction/FluidEngineMember.h++"
+#include "../Concepts/Concepts.h++"
+#include "../Concurrency/JobSystem.h++"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace FluidEngine
+{
+    namespace Mathematics
+    {
+        /**
+         * @brief Sorts 2 or 3 dimensional rectangular positions into the
+         * cells of a uniform grid, so that a radius or k nearest query only
+         * looks at the particles of nearby cells.
+         * @details
+         * Build covers the bounding box of the positions with cubic cells
+         * and counting sorts the particles by cell: one pass to find every
+         * particle's cell, one to count them, a prefix sum, and one to copy
+         * every position next to the others of its cell. A query then goes
+         * through a few runs of contiguous memory instead of all n
+         * particles.
+         *
+         * Distances are compared squared, exactly like the Magnitude() of
+         * the difference of two VectorBases, so
+         * `(a - b).Magnitude() <= radius * radius` holds for a neighbor b of
+         * a, with the same rounding.
+         *
+         * Queries do not change the grid, so any number of threads can run
+         * them at once (as long as nobody is building or updating it).
+         * @author Joshua Buchanan
+         * @tparam Floating float, double or long double
+         */
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        class SpatialGrid : public Abstraction::FluidEngineMember
+        {
+        public:
+            using VectorType = Floating;
+
+            /**
+             * @brief How many cells there are per particle at most; cells
+             * are made bigger than asked for if there would be more
+             *
+             */
+            static constexpr std::size_t cellsPerParticle = 2;
+
+            /**
+             * @brief How many positions one ParallelFor chunk of a parallel
+             * build handles
+             *
+             */
+            static constexpr std::size_t buildGrain = 4096;
+
+        private:
+
+            VectorDimensions dimensions;
+            VectorType cellSize;
+
+            VectorType spacing;
+            VectorType inverseSpacing;
+            VectorType slack;
+            std::array<VectorType, 3> lower;
+            std::array<VectorType, 3> upper;
+            std::array<std::size_t, 3> cellCounts;
+
+            /**
+             * @brief Where every cell's particles start in the sorted
+             * arrays, plus the end of the last cell
+             *
+             */
+            std::vector<std::uint32_t> cellStarts;
+
+            /**
+             * @brief Which cell every particle is in, by particle
+             *
+             */
+            std::vector<std::uint32_t> cells;
+
+            /**
+             * @brief Where every particle is in the sorted arrays, by
+             * particle
+             *
+             */
+            std::vector<std::uint32_t> slots;
+
+            /**
+             * @brief Which particle is in every slot of the sorted arrays
+             *
+             */
+            std::vector<std::uint32_t> particles;
+
+            /**
+             * @brief The positions, sorted by cell (z is 0 for 2 dimensions)
+             *
+             */
+            std::array<std::vector<VectorType>, 3> sorted;
+
+            /**
+             * @brief A particle that changed cells in Update, and the cell it
+             * left
+             *
+             */
+            struct Move
+            {
+                std::uint32_t particle;
+                std::uint32_t from;
+            };
+
+            /**
+             * @brief Update's scratch space, kept so that it does not
+             * allocate every call: the particles that changed cells, the
+             * runs of cells they left or entered, and one run's particles in
+             * their new order
+             *
+             */
+            std::vector<Move> moves;
+            std::vector<std::pair<std::uint32_t, std::uint32_t>> runs;
+            std::vector<std::uint32_t> reordered;
+
+            /**
+             * @brief Covers positions with cells and finds every particle's
+             * cell
+             *
+             */
+            Abstraction::Acknowledgement Locate
+            (
+                const VectorBatch<VectorType>& positions,
+                Concurrency::JobSystem* system
+            ) noexcept;
+
+            /**
+             * @brief The counting sort, from the cells Locate found
+             *
+             */
+            void Sort
+            (
+                const VectorBatch<VectorType>& positions,
+                Concurrency::JobSystem* system
+            ) noexcept;
+
+            /**
+             * @brief Redoes Sort only over the runs of cells the particles in
+             * moves left or entered; every other slot stays where it is
+             *
+             */
+            void Resort(const VectorBatch<VectorType>& positions) noexcept;
+
+            /**
+             * @brief Locate, then Sort
+             *
+             */
+            Abstraction::Acknowledgement Build
+            (
+                const VectorBatch<VectorType>& positions,
+                Concurrency::JobSystem* system
+            ) noexcept;
+
+            /**
+             * @brief The cell a position is in along one axis (positions
+             * outside the grid are clamped to it)
+             *
+             */
+            std::size_t CellAlong
+            (
+                const std::size_t& axis,
+                const VectorType& coordinate
+            ) const noexcept;
+
+            /**
+             * @brief The squared distance between point and the particle in
+             * slot
+             *
+             */
+            VectorType DistanceSquared
+            (
+                const std::array<VectorType, 3>& point,
+                const std::size_t& slot
+            ) const noexcept;
+
+        public:
+
+            SpatialGrid
+            (
+                const std::wstring&,
+                const VectorDimensions&,
+                const VectorType&
+            ) noexcept;
+
+            SpatialGrid
+            (
+                const VectorDimensions&,
+                const VectorType&
+            ) noexcept;
+
+            /**
+             * @brief Sorts positions into the grid, replacing whatever was
+             * in it
+             * @author Joshua Buchanan
+             * @param positions rectangular, with this grid's dimensions
+             * @return Abstraction::Acknowledgement Failure (and the grid is
+             * empty) if positions has other tags, holds more than
+             * (2^32 - 65) / cellsPerParticle (2^31 - 33) vectors, any of
+             * them is not finite, or they are further apart along an axis
+             * than the largest finite VectorType, or the cell size the grid
+             * was constructed with is not positive and finite
+             */
+            Abstraction::Acknowledgement Build
+            (
+                const VectorBatch<VectorType>& positions
+            ) noexcept;
+
+            /**
+             * @brief Build, with the cells found and the positions copied by
+             * the threads of system
+             * @note Gives exactly the same grid as Build without a
+             * JobSystem.
+             * @author Joshua Buchanan
+             * @param positions rectangular, with this grid's dimensions
+             * @param system
+             * @return Abstraction::Acknowledgement see Build
+             */
+            Abstraction::Acknowledgement Build
+            (
+                const VectorBatch<VectorType>& positions,
+                Concurrency::JobSystem& system
+            ) noexcept;
+
+            /**
+             * @brief Build, from VectorBases
+             * @author Joshua Buchanan
+             * @param positions rectangular, with this grid's dimensions
+             * @return Abstraction::Acknowledgement see Build
+             */
+            Abstraction::Acknowledgement Build
+            (
+                std::span<const VectorBase<VectorType>> positions
+            ) noexcept;
+
+            /**
+             * @brief Catches up with a few particles having moved
+             * @details
+             * Particles that stayed in their cell are just overwritten in
+             * place. A particle that changed cells only disturbs the slots
+             * of the cells from the one it left to the one it entered, so
+             * only those are laid out again; with small moves that is a few
+             * cells per particle instead of the whole grid. If more than an
+             * eighth of the particles changed cells, the counting sort is
+             * redone over every particle instead (still without locating
+             * them again). If one left the grid, or positions is not the
+             * size the grid was built with, the grid is built again from
+             * scratch. Either way the grid is exactly what Build would make.
+             * @author Joshua Buchanan
+             * @param positions every position, as Build got them, with the
+             * moved ones changed
+             * @param moved which particles moved (the rest must not have)
+             * @return Abstraction::Acknowledgement Failure if an index in
+             * moved is out of range, or for anything Build fails for
+             */
+            Abstraction::Acknowledgement Update
+            (
+                const VectorBatch<VectorType>& positions,
+                std::span<const std::size_t> moved
+            ) noexcept;
+
+            /**
+             * @brief How many particles are in the grid
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            std::size_t Size() const noexcept;
+
+            /**
+             * @brief How many cells the grid has
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            std::size_t CellCount() const noexcept;
+
+            /**
+             * @brief How big the cells are: the size the grid was
+             * constructed with, or bigger if that would have made too many
+             * cells (see cellsPerParticle)
+             * @author Joshua Buchanan
+             * @return const VectorType&
+             */
+            const VectorType& GetCellSize() const noexcept;
+
+            /**
+             * @brief Finds every particle within radius of point
+             * @author Joshua Buchanan
+             * @param point where to look around (z is ignored in 2
+             * dimensions)
+             * @param radius
+             * @param neighbors replaced with the indices (into the positions
+             * the grid was built from) of every particle whose squared
+             * distance to point is at most radius * radius, in no particular
+             * order
+             */
+            void FindNeighbors
+            (
+                const std::array<VectorType, 3>& point,
+                const VectorType& radius,
+                std::vector<std::size_t>& neighbors
+            ) const noexcept;
+
+            /**
+             * @brief Finds the count particles nearest to point
+             * @details Searches rings of cells around point, outwards, until
+             * no particle further out can be nearer than the ones found.
+             * @author Joshua Buchanan
+             * @param point where to look around (z is ignored in 2
+             * dimensions)
+             * @param count how many particles to find (all of them, if there
+             * are fewer)
+             * @param nearest replaced with their indices, nearest first;
+             * ties go to the lower index
+             */
+            void FindNearest
+            (
+                const std::array<VectorType, 3>& point,
+                const std::size_t& count,
+                std::vector<std::size_t>& nearest
+            ) const noexcept;
+        };
+
+    } // namespace Mathematics
+
+} // namespace FluidEngine
+
+
+#endif
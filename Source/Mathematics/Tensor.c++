@@ -12,17 +12,32 @@
 #include "Tensor.h++"
 
 #include "../Abstraction/Unification.h++"
+#include "../Diagnostics/Instrumentation.h++"
 
 #include "FastInverseSquareRoots.h++"
 
+#include <cmath>
+
 using namespace FluidEngine::Mathematics;
 
 
 
+/**
+ * @brief The name vectors get when nobody names them
+ * @author Joshua Buchanan
+ * @return const FluidEngine::Abstraction::NameHandle&
+ */
+static const FluidEngine::Abstraction::NameHandle& UnnamedVector() noexcept
+{
+    static const FluidEngine::Abstraction::NameHandle unnamed =
+        FluidEngine::Abstraction::NameTable::Intern(L"Unnamed Vector");
+    return unnamed;
+}
+
 /**
  * @brief Constructs a VectorBase
  * @author Joshua Buchanan
- * @param vectorName the name of the vector
+ * @param vectorName handle of the name of the vector
  * @param dimensions the dimensions of this vector
  * @param formatting the formatting of this vector
  * @param xOrR the x coordinate or the radius
@@ -34,7 +49,7 @@ using namespace FluidEngine::Mathematics;
 template<FluidEngine::Concepts::UsableInVectorBase Precision>
 VectorBase<Precision>::VectorBase
 (
-    const std::wstring& vectorName,
+    const Abstraction::NameHandle& vectorName,
     const VectorDimensions& dimensions,
     const VectorFormatting& formatting,
     const VectorType& xOrR,
@@ -53,6 +68,7 @@ VectorBase<Precision>::VectorBase
 /**
  * @brief Constructs a VectorBase
  * @author Joshua Buchanan
+ * @param vectorName the name of the vector
  * @param dimensions the dimensions of this vector
  * @param formatting the formatting of this vector
  * @param xOrR the x coordinate or the radius
@@ -64,6 +80,7 @@ VectorBase<Precision>::VectorBase
 template<FluidEngine::Concepts::UsableInVectorBase Precision>
 VectorBase<Precision>::VectorBase
 (
+    const std::wstring& vectorName,
     const VectorDimensions& dimensions,
     const VectorFormatting& formatting,
     const VectorType& xOrR,
@@ -72,7 +89,40 @@ VectorBase<Precision>::VectorBase
 ) noexcept 
 : VectorBase
 (
-    L"Unnamed Vector", 
+    Abstraction::NameTable::Intern(vectorName), 
+    dimensions, 
+    formatting, 
+    xOrR, 
+    yOr\u0398, 
+    zOr\u03d5
+) 
+{
+    /*Intentionally left blank*/
+}
+
+/**
+ * @brief Constructs a VectorBase
+ * @author Joshua Buchanan
+ * @param dimensions the dimensions of this vector
+ * @param formatting the formatting of this vector
+ * @param xOrR the x coordinate or the radius
+ * @param xOrΘ the y coordinate or the angle theta
+ * @param zOrϕ the z coordinate or the angle phi
+ * 
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+VectorBase<Precision>::VectorBase
+(
+    const VectorDimensions& dimensions,
+    const VectorFormatting& formatting,
+    const VectorType& xOrR,
+    const VectorType& yOrΘ,
+    const VectorType& zOrϕ
+) noexcept 
+: VectorBase
+(
+    UnnamedVector(), 
     dimensions, 
     formatting, 
     xOrR, 
@@ -124,7 +174,7 @@ VectorBase<float> VectorBase<Precision>::ConvertLowPrecision() const noexcept
 {
     return VectorBase<float>
     (
-        this->GetReferenceName(),
+        this->GetNameHandle(),
         this->dimensions,
         this->formatting,
         (float)(this->coordinates[0]),
@@ -138,7 +188,7 @@ VectorBase<float> VectorBase<Precision>::ConvertLowPrecision() noexcept
 {
     return VectorBase<float>
     (
-        this->GetReferenceName(),
+        this->GetNameHandle(),
         this->dimensions,
         this->formatting,
         (float)(this->coordinates[0]),
@@ -152,7 +202,7 @@ VectorBase<double> VectorBase<Precision>::ConvertMidPrecision() const noexcept
 {
     return VectorBase<double>
     (
-        this->GetReferenceName(),
+        this->GetNameHandle(),
         this->dimensions,
         this->formatting,
         (double)(this->coordinates[0]),
@@ -166,7 +216,7 @@ VectorBase<double> VectorBase<Precision>::ConvertMidPrecision() noexcept
 {
     return VectorBase<double>
     (
-        this->GetReferenceName(),
+        this->GetNameHandle(),
         this->dimensions,
         this->formatting,
         (double)(this->coordinates[0]),
@@ -181,7 +231,7 @@ VectorBase<long double> VectorBase<Precision>::ConvertMaxPrecision() const noexc
 {
     return VectorBase<long double>
     (
-        this->GetReferenceName(),
+        this->GetNameHandle(),
         this->dimensions,
         this->formatting,
         (long double)(this->coordinates[0]),
@@ -195,7 +245,7 @@ VectorBase<long double> VectorBase<Precision>::ConvertMaxPrecision() noexcept
 {
     return VectorBase<long double>
     (
-        this->GetReferenceName(),
+        this->GetNameHandle(),
         this->dimensions,
         this->formatting,
         (long double)(this->coordinates[0]),
@@ -209,8 +259,7 @@ VectorBase<Precision> VectorBase<Precision>::AsRectangular() const noexcept
 {
     if(this->formatting == VectorFormatting::Rct)
     {
-        return (VectorBase<Precision>)
-        (Abstraction::FluidEngineMember::GetThisData(this));
+        return *this;
     }
     else
     {
@@ -236,13 +285,13 @@ VectorBase<Precision> VectorBase<Precision>::AsRectangular() const noexcept
         }
         else
         {
-            z = std::numeric_limits<Precision>::quiet_nan();
+            z = std::numeric_limits<Precision>::quiet_NaN();
         }
         
 
         return VectorBase<Precision>
         (
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             VectorFormatting::Rct,
             x,
@@ -257,8 +306,7 @@ VectorBase<Precision> VectorBase<Precision>::AsRectangular() noexcept
 {
     if(this->formatting == VectorFormatting::Rct)
     {
-        return (VectorBase<Precision>)
-        (Abstraction::FluidEngineMember::GetThisData(this));
+        return *this;
     }
     else
     {
@@ -284,13 +332,13 @@ VectorBase<Precision> VectorBase<Precision>::AsRectangular() noexcept
         }
         else
         {
-            z = std::numeric_limits<Precision>::quiet_nan();
+            z = std::numeric_limits<Precision>::quiet_NaN();
         }
         
 
         return VectorBase<Precision>
         (
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             VectorFormatting::Rct,
             x,
@@ -320,7 +368,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolar() const noexcept
         {
             return VectorBase<Precision>
             (
-                this->GetReferenceName(),
+                this->GetNameHandle(),
                 VectorDimensions::D2,
                 VectorFormatting::Plr,
                 this->Magnitude(),
@@ -331,7 +379,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolar() const noexcept
         {
             return VectorBase<Precision>
             (
-                this->GetReferenceName(),
+                this->GetNameHandle(),
                 VectorDimensions::D3,
                 VectorFormatting::Plr,
                 this->Magnitude(),
@@ -356,8 +404,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolar() const noexcept
     }
     else
     {
-        return (VectorBase<Precision>)
-        (Abstraction::FluidEngineMember::GetThisData(this));
+        return *this;
     }
     
 }
@@ -382,7 +429,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolar() noexcept
         {
             return VectorBase<Precision>
             (
-                this->GetReferenceName(),
+                this->GetNameHandle(),
                 VectorDimensions::D2,
                 VectorFormatting::Plr,
                 this->Magnitude(),
@@ -393,7 +440,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolar() noexcept
         {
             return VectorBase<Precision>
             (
-                this->GetReferenceName(),
+                this->GetNameHandle(),
                 VectorDimensions::D3,
                 VectorFormatting::Plr,
                 this->Magnitude(),
@@ -418,8 +465,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolar() noexcept
     }
     else
     {
-        return (VectorBase<Precision>)
-        (Abstraction::FluidEngineMember::GetThisData(this));
+        return *this;
     }
     
 }
@@ -430,8 +476,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolarFast() const noexcept
     // 
     if (this->formatting == VectorFormatting::Plr)
     {
-        return (VectorBase<Precision>)
-        (Abstraction::FluidEngineMember::GetThisData(this));
+        return *this;
     }
     else
     {
@@ -450,7 +495,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolarFast() const noexcept
         {
             return VectorBase<Precision>
             (
-                this->GetReferenceName(),
+                this->GetNameHandle(),
                 VectorDimensions::D2,
                 VectorFormatting::Plr,
                 this->Magnitude(),
@@ -461,7 +506,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolarFast() const noexcept
         {
             return VectorBase<Precision>
             (
-                this->GetReferenceName(),
+                this->GetNameHandle(),
                 VectorDimensions::D3,
                 VectorFormatting::Plr,
                 this->Magnitude(),
@@ -492,8 +537,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolarFast() noexcept
     // 
     if (this->formatting == VectorFormatting::Plr)
     {
-        return (VectorBase<Precision>)
-        (Abstraction::FluidEngineMember::GetThisData(this));
+        return *this;
     }
     else
     {
@@ -512,7 +556,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolarFast() noexcept
         {
             return VectorBase<Precision>
             (
-                this->GetReferenceName(),
+                this->GetNameHandle(),
                 VectorDimensions::D2,
                 VectorFormatting::Plr,
                 this->Magnitude(),
@@ -523,7 +567,7 @@ VectorBase<Precision> VectorBase<Precision>::AsPolarFast() noexcept
         {
             return VectorBase<Precision>
             (
-                this->GetReferenceName(),
+                this->GetNameHandle(),
                 VectorDimensions::D3,
                 VectorFormatting::Plr,
                 this->Magnitude(),
@@ -555,7 +599,7 @@ VectorBase<Precision> VectorBase<Precision>::ExpandToThreeDimensions
 {
     return VectorBase<Precision>
     (
-        this->GetReferenceName(),
+        this->GetNameHandle(),
         VectorDimensions::D3,
         this->formatting,
         this->coordinates[0],
@@ -572,7 +616,7 @@ VectorBase<Precision> VectorBase<Precision>::ExpandToThreeDimensions
 {
     return VectorBase<Precision>
     (
-        this->GetReferenceName(),
+        this->GetNameHandle(),
         VectorDimensions::D3,
         this->formatting,
         this->coordinates[0],
@@ -587,7 +631,7 @@ const noexcept
 {
     return VectorBase<Precision>
     (
-        this->name,
+        this->GetNameHandle(),
         VectorDimensions::D2,
         this->formatting,
         this->coordinates[0],
@@ -601,7 +645,7 @@ noexcept
 {
     return VectorBase<Precision>
     (
-        this->name,
+        this->GetNameHandle(),
         VectorDimensions::D2,
         this->formatting,
         this->coordinates[0],
@@ -616,7 +660,7 @@ VectorBase<Precision> VectorBase<Precision>::NormalizedForm() const noexcept
     {
         return VectorBase<Precision>
         (
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             this->formatting,
             1,
@@ -626,16 +670,18 @@ VectorBase<Precision> VectorBase<Precision>::NormalizedForm() const noexcept
     }
     else
     {
+        FluidEngineCount(VectorsNormalized);
+        FluidEngineCount(ExactPathHits);
         const Precision magnitude = this->Magnitude();
 
         return VectorBase<Precision>
         (
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             this->formatting,
-            this->coordinates[0] / magnitude,
-            this->coordinates[1] / magnitude,
-            this->coordinates[2] / magnitude
+            this->coordinates[0] / std::sqrt(magnitude),
+            this->coordinates[1] / std::sqrt(magnitude),
+            this->coordinates[2] / std::sqrt(magnitude)
         );
     }
     
@@ -648,7 +694,7 @@ VectorBase<Precision> VectorBase<Precision>::NormalizedForm() noexcept
     {
         return VectorBase<Precision>
         (
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             this->formatting,
             1,
@@ -658,11 +704,13 @@ VectorBase<Precision> VectorBase<Precision>::NormalizedForm() noexcept
     }
     else
     {
+        FluidEngineCount(VectorsNormalized);
+        FluidEngineCount(ExactPathHits);
         const Precision magnitude = this->Magnitude();
 
         return VectorBase<Precision>
         (
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             this->formatting,
             this->coordinates[0] / std::sqrt(magnitude),
@@ -680,7 +728,7 @@ VectorBase<Precision> VectorBase<Precision>::FastNormalize() const noexcept
     {
         return VectorBase<Precision>
         (
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             this->formatting,
             1,
@@ -690,11 +738,13 @@ VectorBase<Precision> VectorBase<Precision>::FastNormalize() const noexcept
     }
     else
     {
+        FluidEngineCount(VectorsNormalized);
+        FluidEngineCount(FastPathHits);
         const Precision magnitude = this->Magnitude();
         const Precision multiplicationFactor = FastInverseSquareRoot(magnitude);
 
         return VectorBase<Precision>(
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             this->formatting,
             this->coordinates[0] * multiplicationFactor,
@@ -711,7 +761,7 @@ VectorBase<Precision> VectorBase<Precision>::FastNormalize() noexcept
     {
         return VectorBase<Precision>
         (
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             this->formatting,
             1,
@@ -721,11 +771,13 @@ VectorBase<Precision> VectorBase<Precision>::FastNormalize() noexcept
     }
     else
     {
+        FluidEngineCount(VectorsNormalized);
+        FluidEngineCount(FastPathHits);
         const Precision magnitude = this->Magnitude();
         const Precision multiplicationFactor = FastInverseSquareRoot(magnitude);
 
         return VectorBase<Precision>(
-            this->GetReferenceName(),
+            this->GetNameHandle(),
             this->dimensions,
             this->formatting,
             this->coordinates[0] * multiplicationFactor,
@@ -770,3 +822,24 @@ const Precision VectorBase<Precision>::Magnitude() noexcept
     
 }
 
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Expressions::ReflectionExpression
+<
+    Expressions::VectorReference<Precision>,
+    Expressions::VectorReference<Precision>
+>
+VectorBase<Precision>::Reflection
+(
+    const VectorBase<Precision>& normal
+) const noexcept
+{
+    return Expressions::Reflection(*this, normal);
+}
+
+//-----------------------------------------------------------------------------
+// Explicit instantiations, so that the definitions can live in here
+//-----------------------------------------------------------------------------
+
+template class FluidEngine::Mathematics::VectorBase<float>;
+template class FluidEngine::Mathematics::VectorBase<double>;
+template class FluidEngine::Mathematics::VectorBase<long double>;
@@ -22,6 +22,15 @@ namespace FluidEngine
 {
     namespace Mathematics
     {
+        namespace Expressions
+        {
+            template<typename Floating>
+            struct VectorReference;
+
+            template<typename Direction, typename Normal>
+            struct ReflectionExpression;
+        } // namespace Expressions
+
         /**
          * @brief Whether this vector is a 2 or 3 dimensional one
          * @note 2 and 3 dimensional vectors use the same amount of
@@ -93,7 +102,19 @@ namespace FluidEngine
                 const VectorType&, 
                 const VectorType& = std::numeric_limits<
                     VectorType
-                >::quiet_nan()
+                >::quiet_NaN()
+            ) noexcept;
+
+            VectorBase
+            (
+                const Abstraction::NameHandle&,
+                const VectorDimensions&,
+                const VectorFormatting&, 
+                const VectorType&, 
+                const VectorType&, 
+                const VectorType& = std::numeric_limits<
+                    VectorType
+                >::quiet_NaN()
             ) noexcept;
 
             VectorBase
@@ -104,7 +125,7 @@ namespace FluidEngine
                 const VectorType&,
                 const VectorType& = std::numeric_limits<
                     VectorType
-                >::quiet_nan()
+                >::quiet_NaN()
             ) noexcept;
 
             /**
@@ -337,50 +358,21 @@ namespace FluidEngine
              */
             const VectorType Magnitude() noexcept;
 
-            const VectorBase<VectorType>& operator+
-            (
-                const VectorBase<VectorType>&
-            ) const noexcept;
-            const VectorBase<VectorType>& operator+
-            (
-                const VectorBase<VectorType>&
-            ) noexcept;
-
-            const VectorBase<VectorType>& operator-
-            (
-                const VectorBase<VectorType>&
-            ) const noexcept;
-            const VectorBase<VectorType>& operator-
-            (
-                const VectorBase<VectorType>&
-            ) noexcept;
-
-            const VectorBase<VectorType>& operator*
-            (
-                const VectorBase<VectorType>&
-            ) const noexcept;
-            const VectorBase<VectorType>& operator*
-            (
-                const VectorBase<VectorType>&
-            ) noexcept;
-
-            const VectorBase<VectorType>& operator/
-            (
-                const VectorBase<VectorType>&
-            ) const noexcept;
-            const VectorBase<VectorType>& operator/
-            (
-                const VectorBase<VectorType>&
-            ) noexcept;
-
-            const VectorBase<VectorType>& Reflection
-            (
-                const VectorBase<VectorType>&
-            ) const noexcept;
-            const VectorBase<VectorType>& Reflection
-            (
-                const VectorBase<VectorType>&
-            ) noexcept;
+            /**
+             * @brief Reflects this about the (unit) normal: d - 2 (d . n) n
+             * @note Lazy, like + - * and / (see VectorExpressions.h++): the
+             * result is computed when it becomes a VectorBase, so do that
+             * in the same statement. Polar vectors are not reflected.
+             * @author Joshua Buchanan
+             * @param normal the unit normal of the reflecting surface
+             * @return an expression that evaluates to a VectorBase
+             */
+            Expressions::ReflectionExpression
+            <
+                Expressions::VectorReference<VectorType>,
+                Expressions::VectorReference<VectorType>
+            >
+            Reflection(const VectorBase<VectorType>& normal) const noexcept;
 
             
             //-----------------------------------------------------------------
@@ -604,5 +596,7 @@ namespace FluidEngine
     
 } // namespace FluidEngine
 
+// + - * / live in here, and need VectorBase to be complete
+#include "VectorExpressions.h++"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,371 @@
+/**
+ * @file VectorBatch.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for VectorBatch.h++
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "VectorBatch.h++"
+
+#include "BatchKernels.h++"
+#include "../Diagnostics/Instrumentation.h++"
+
+#include <algorithm>
+#include <limits>
+
+using namespace FluidEngine::Mathematics;
+
+/**
+ * @brief Constructs a VectorBatch
+ * @author Joshua Buchanan
+ * @param batchName handle of the name of the batch
+ * @param dimensions the dimensions of every vector in here
+ * @param formatting the formatting of every vector in here
+ * @param count how many (zero) vectors to start with
+ *
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+VectorBatch<Precision>::VectorBatch
+(
+    const Abstraction::NameHandle& batchName,
+    const VectorDimensions& dimensions,
+    const VectorFormatting& formatting,
+    const std::size_t& count
+) noexcept : Abstraction::FluidEngineMember(batchName)
+{
+    this->dimensions = dimensions;
+    this->formatting = formatting;
+
+    this->Resize(count);
+}
+
+/**
+ * @brief Constructs a VectorBatch
+ * @author Joshua Buchanan
+ * @param batchName the name of the batch
+ * @param dimensions the dimensions of every vector in here
+ * @param formatting the formatting of every vector in here
+ * @param count how many (zero) vectors to start with
+ *
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+VectorBatch<Precision>::VectorBatch
+(
+    const std::wstring& batchName,
+    const VectorDimensions& dimensions,
+    const VectorFormatting& formatting,
+    const std::size_t& count
+) noexcept
+: VectorBatch
+(
+    Abstraction::NameTable::Intern(batchName),
+    dimensions,
+    formatting,
+    count
+)
+{
+    /*Intentionally left blank*/
+}
+
+/**
+ * @brief Constructs a VectorBatch
+ * @author Joshua Buchanan
+ * @param dimensions the dimensions of every vector in here
+ * @param formatting the formatting of every vector in here
+ * @param count how many (zero) vectors to start with
+ *
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+VectorBatch<Precision>::VectorBatch
+(
+    const VectorDimensions& dimensions,
+    const VectorFormatting& formatting,
+    const std::size_t& count
+) noexcept
+: VectorBatch
+(
+    L"Unnamed Vector Batch",
+    dimensions,
+    formatting,
+    count
+)
+{
+    /*Intentionally left blank*/
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::size_t VectorBatch<Precision>::UsedColumns() const noexcept
+{
+    return this->dimensions == VectorDimensions::D3 ? 3 : 2;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+VectorBatch<Precision> VectorBatch<Precision>::EmptyLike() const noexcept
+{
+    return VectorBatch<Precision>
+    (
+        this->GetNameHandle(),
+        this->dimensions,
+        this->formatting,
+        this->Size()
+    );
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+const VectorDimensions& VectorBatch<Precision>::GetDimensions() const noexcept
+{
+    return this->dimensions;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+const VectorFormatting& VectorBatch<Precision>::GetFormatting() const noexcept
+{
+    return this->formatting;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+bool VectorBatch<Precision>::IsLaidOutLike
+(
+    const VectorBatch<Precision>& other
+) const noexcept
+{
+    return this->dimensions == other.dimensions &&
+        this->formatting == other.formatting;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::size_t VectorBatch<Precision>::Size() const noexcept
+{
+    return this->columns[0].size();
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void VectorBatch<Precision>::Resize(const std::size_t& count) noexcept
+{
+    for (std::size_t column = 0; column < this->UsedColumns(); ++column)
+    {
+        this->columns[column].resize(count);
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void VectorBatch<Precision>::Reserve(const std::size_t& count) noexcept
+{
+    for (std::size_t column = 0; column < this->UsedColumns(); ++column)
+    {
+        this->columns[column].reserve(count);
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::span<const Precision> VectorBatch<Precision>::GetColumn
+(
+    const std::size_t& index
+) const noexcept
+{
+    return std::span<const Precision>(this->columns[index]);
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::span<Precision> VectorBatch<Precision>::GetColumn
+(
+    const std::size_t& index
+) noexcept
+{
+    return std::span<Precision>(this->columns[index]);
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+FluidEngine::Abstraction::Acknowledgement VectorBatch<Precision>::Import
+(
+    const VectorBase<Precision>& vector
+) noexcept
+{
+    return this->Import(std::span<const VectorBase<Precision>>(&vector, 1));
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+FluidEngine::Abstraction::Acknowledgement VectorBatch<Precision>::Import
+(
+    std::span<const VectorBase<Precision>> vectors
+) noexcept
+{
+    // check everything first so that a failure adds nothing
+    for (const VectorBase<Precision>& vector : vectors)
+    {
+        if (vector.GetDimensions() != this->dimensions ||
+            vector.GetFormatting() != this->formatting)
+        {
+            return Abstraction::Acknowledgement::Failure;
+        }
+    }
+
+    this->Reserve(this->Size() + vectors.size());
+    for (const VectorBase<Precision>& vector : vectors)
+    {
+        for (std::size_t column = 0; column < this->UsedColumns(); ++column)
+        {
+            this->columns[column].push_back(vector.GetCoordinates()[column]);
+        }
+    }
+
+    return Abstraction::Acknowledgement::Success;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+VectorBase<Precision> VectorBatch<Precision>::Export
+(
+    const std::size_t& index
+) const noexcept
+{
+    return VectorBase<Precision>
+    (
+        this->GetNameHandle(),
+        this->dimensions,
+        this->formatting,
+        this->columns[0][index],
+        this->columns[1][index],
+        this->dimensions == VectorDimensions::D3 ?
+            this->columns[2][index] :
+            std::numeric_limits<Precision>::quiet_NaN()
+    );
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::vector<VectorBase<Precision>> VectorBatch<Precision>::ExportAll()
+const noexcept
+{
+    std::vector<VectorBase<Precision>> exported;
+    exported.reserve(this->Size());
+
+    for (std::size_t index = 0; index < this->Size(); ++index)
+    {
+        exported.push_back(this->Export(index));
+    }
+
+    return exported;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+typename VectorBatch<Precision>::ColumnType
+VectorBatch<Precision>::Magnitude() const noexcept
+{
+    if (this->formatting == VectorFormatting::Plr)
+    {
+        return this->columns[0];
+    }
+    else
+    {
+        ColumnType magnitudes(this->Size());
+
+        BatchKernels::Magnitude<Precision>
+        (
+            {
+                this->GetColumn(0),
+                this->GetColumn(1),
+                this->GetColumn(2)
+            },
+            magnitudes
+        );
+
+        return magnitudes;
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+VectorBatch<Precision> VectorBatch<Precision>::NormalizedForm() const noexcept
+{
+    FluidEngineZone("VectorBatch::NormalizedForm");
+
+    if (this->formatting == VectorFormatting::Plr)
+    {
+        VectorBatch<Precision> normalized = *this;
+        std::fill
+        (
+            normalized.columns[0].begin(),
+            normalized.columns[0].end(),
+            1
+        );
+        return normalized;
+    }
+    else
+    {
+        VectorBatch<Precision> normalized = this->EmptyLike();
+
+        BatchKernels::Normalize<Precision>
+        (
+            {
+                this->GetColumn(0),
+                this->GetColumn(1),
+                this->GetColumn(2)
+            },
+            {
+                normalized.GetColumn(0),
+                normalized.GetColumn(1),
+                normalized.GetColumn(2)
+            }
+        );
+
+        return normalized;
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+VectorBatch<Precision> VectorBatch<Precision>::FastNormalize() const noexcept
+{
+    FluidEngineZone("VectorBatch::FastNormalize");
+
+    if (this->formatting == VectorFormatting::Plr)
+    {
+        return this->NormalizedForm();
+    }
+    else
+    {
+        VectorBatch<Precision> normalized = this->EmptyLike();
+
+        BatchKernels::FastNormalize<Precision>
+        (
+            {
+                this->GetColumn(0),
+                this->GetColumn(1),
+                this->GetColumn(2)
+            },
+            {
+                normalized.GetColumn(0),
+                normalized.GetColumn(1),
+                normalized.GetColumn(2)
+            }
+        );
+
+        return normalized;
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Expressions::ReflectionExpression
+<
+    Expressions::BatchReference<Precision>,
+    Expressions::BatchReference<Precision>
+>
+VectorBatch<Precision>::Reflection
+(
+    const VectorBatch<Precision>& normals
+) const noexcept
+{
+    return Expressions::Reflection(*this, normals);
+}
+
+//-----------------------------------------------------------------------------
+// Explicit instantiations, so that the definitions can live in here
+//-----------------------------------------------------------------------------
+
+template class FluidEngine::Mathematics::VectorBatch<float>;
+template class FluidEngine::Mathematics::VectorBatch<double>;
+template class FluidEngine::Mathematics::VectorBatch<long double>;
@@ -0,0 +1,517 @@
+/**
+ * @file VectorBatch.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines VectorBatch, a structure-of-arrays collection of vectors
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef VectorBatchFile
+#define VectorBatchFile
+
+#include "Tensor.h++"
+#include "BatchKernels.h++"
+#include "VectorExpressions.h++"
+#include "../Abstraction/AlignedAllocator.h++"
+#include "../Abstraction/FluidEngineMember.h++"
+#include "../Diagnostics/Instrumentation.h++"
+#include "../Concepts/Concepts.h++"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace FluidEngine
+{
+    namespace Mathematics
+    {
+        /**
+         * @brief Lots of vectors that share one dimensions / formatting tag,
+         * stored as separate (aligned) x, y and z columns.
+         * @details
+         * A VectorBase carries a vtable, a name and an identification number
+         * around its three coordinates, and only ever does math one vector
+         * at a time. A VectorBatch is one FluidEngineMember for the whole
+         * lot, and its math runs through BatchKernels, which use SSE2 or
+         * AVX2 when the CPU has them. Every batch operation gives the same
+         * result as calling the VectorBase operation on each vector.
+         *
+         * 2 dimensional batches do not store a third column at all; it
+         * reappears as quiet NaN when a vector is exported.
+         * @author Joshua Buchanan
+         * @tparam Floating float, double or long double
+         */
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        class VectorBatch : public Abstraction::FluidEngineMember
+        {
+        public:
+            using VectorType = Floating;
+            using ColumnType = std::vector
+            <
+                VectorType,
+                Abstraction::AlignedAllocator<VectorType>
+            >;
+
+        private:
+
+            std::array<ColumnType, 3> columns;
+
+            VectorDimensions dimensions;
+            VectorFormatting formatting;
+
+            /**
+             * @brief how many columns this batch actually stores
+             *
+             * @return std::size_t 2 or 3
+             */
+            std::size_t UsedColumns() const noexcept;
+
+            /**
+             * @brief Makes an empty batch with the same name and tags, sized
+             * like this one
+             *
+             * @return VectorBatch<VectorType>
+             */
+            VectorBatch<VectorType> EmptyLike() const noexcept;
+
+        public:
+
+            VectorBatch
+            (
+                const std::wstring&,
+                const VectorDimensions&,
+                const VectorFormatting&,
+                const std::size_t& = 0
+            ) noexcept;
+
+            VectorBatch
+            (
+                const Abstraction::NameHandle&,
+                const VectorDimensions&,
+                const VectorFormatting&,
+                const std::size_t& = 0
+            ) noexcept;
+
+            VectorBatch
+            (
+                const VectorDimensions&,
+                const VectorFormatting&,
+                const std::size_t& = 0
+            ) noexcept;
+
+            /**
+             * @brief Get the quantity of dimensions every vector has
+             * @author Joshua Buchanan
+             * @return const VectorDimensions&
+             */
+            const VectorDimensions& GetDimensions() const noexcept;
+
+            /**
+             * @brief Get the format (Rectangular or Polar) every vector has
+             * @author Joshua Buchanan
+             * @return const VectorFormatting&
+             */
+            const VectorFormatting& GetFormatting() const noexcept;
+
+            /**
+             * @brief Whether other has the same dimensions and formatting,
+             * so that its columns line up with this batch's
+             * @author Joshua Buchanan
+             * @param other
+             * @return bool
+             */
+            bool IsLaidOutLike(const VectorBatch<VectorType>& other)
+            const noexcept;
+
+            /**
+             * @brief How many vectors are in here
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            std::size_t Size() const noexcept;
+
+            /**
+             * @brief Changes how many vectors are in here. New vectors are
+             * all zero.
+             * @author Joshua Buchanan
+             * @param count the new size
+             */
+            void Resize(const std::size_t& count) noexcept;
+
+            /**
+             * @brief Makes room for count vectors without changing Size()
+             * @author Joshua Buchanan
+             * @param count
+             */
+            void Reserve(const std::size_t& count) noexcept;
+
+            /**
+             * @brief Get one coordinate column (0: x or r, 1: y or theta,
+             * 2: z or phi)
+             * @note The third column of a 2 dimensional batch is empty.
+             * @author Joshua Buchanan
+             * @param index which column
+             * @return std::span<const VectorType>
+             */
+            std::span<const VectorType> GetColumn
+            (
+                const std::size_t& index
+            ) const noexcept;
+            /**
+             * @brief Get one coordinate column (0: x or r, 1: y or theta,
+             * 2: z or phi)
+             * @note The third column of a 2 dimensional batch is empty.
+             * @author Joshua Buchanan
+             * @param index which column
+             * @return std::span<VectorType>
+             */
+            std::span<VectorType> GetColumn(const std::size_t& index) noexcept;
+
+            /**
+             * @brief Appends a VectorBase to this batch
+             * @author Joshua Buchanan
+             * @param vector the vector to add
+             * @return Abstraction::Acknowledgement Failure (and nothing is
+             * added) if vector's dimensions or formatting differ from this
+             * batch's
+             */
+            Abstraction::Acknowledgement Import
+            (
+                const VectorBase<VectorType>& vector
+            ) noexcept;
+
+            /**
+             * @brief Appends a bunch of VectorBases to this batch
+             * @author Joshua Buchanan
+             * @param vectors the vectors to add
+             * @return Abstraction::Acknowledgement Failure (and nothing is
+             * added) if any of the vectors has other dimensions or formatting
+             * than this batch
+             */
+            Abstraction::Acknowledgement Import
+            (
+                std::span<const VectorBase<VectorType>> vectors
+            ) noexcept;
+
+            /**
+             * @brief Gets one vector of this batch as a VectorBase named
+             * after this batch
+             * @author Joshua Buchanan
+             * @param index which vector (must be less than Size())
+             * @return VectorBase<VectorType>
+             */
+            VectorBase<VectorType> Export(const std::size_t& index)
+            const noexcept;
+
+            /**
+             * @brief Gets every vector of this batch as VectorBases
+             * @author Joshua Buchanan
+             * @return std::vector<VectorBase<VectorType>>
+             */
+            std::vector<VectorBase<VectorType>> ExportAll() const noexcept;
+
+            /**
+             * @brief Calculates the magnitude of every vector, just like
+             * VectorBase::Magnitude
+             * @author Joshua Buchanan
+             * @return ColumnType
+             */
+            ColumnType Magnitude() const noexcept;
+
+            /**
+             * @brief Normalizes every vector with exact precision, just like
+             * VectorBase::NormalizedForm
+             * @author Joshua Buchanan
+             * @return VectorBatch<VectorType>
+             */
+            VectorBatch<VectorType> NormalizedForm() const noexcept;
+
+            /**
+             * @brief Approximately normalizes every vector using voodoo
+             * math, just like VectorBase::FastNormalize
+             * @author Joshua Buchanan
+             * @return VectorBatch<VectorType>
+             */
+            VectorBatch<VectorType> FastNormalize() const noexcept;
+
+            /**
+             * @brief Reflects every vector about the matching unit normal:
+             * d - 2 (d . n) n
+             * @note Lazy, like + - * and / (see VectorExpressions.h++): the
+             * result is computed when it becomes a VectorBatch, so do that
+             * in the same statement. A polar batch kind of does nothing (you
+             * get the same vectors back).
+             * @author Joshua Buchanan
+             * @param normals unit normals, one per vector
+             * @return an expression that evaluates to a VectorBatch
+             */
+            Expressions::ReflectionExpression
+            <
+                Expressions::BatchReference<VectorType>,
+                Expressions::BatchReference<VectorType>
+            >
+            Reflection
+            (
+                const VectorBatch<VectorType>& normals
+            ) const noexcept;
+
+            /**
+             * @brief Evaluates an expression (like `positions + velocities *
+             * dt`) into a new batch, in one pass over the vectors
+             * @note The batch gets the name and tags of the leftmost vector
+             * operand, and as many vectors as the smallest batch operand.
+             * @author Joshua Buchanan
+             * @tparam Expression
+             * @param expression
+             */
+            template<Expressions::BatchExpressionOf<VectorType> Expression>
+            VectorBatch(const Expression& expression) noexcept
+            : Abstraction::FluidEngineMember(expression.GetNameHandle())
+            {
+                this->Evaluate(expression);
+            }
+
+            /**
+             * @brief Evaluates an expression into this batch, in one pass
+             * over the vectors and reusing this batch's columns
+             * @note This batch keeps its name, but takes the tags of the
+             * leftmost vector operand. It may appear in the expression
+             * itself (`positions = positions + velocities * dt`).
+             * @author Joshua Buchanan
+             * @tparam Expression
+             * @param expression
+             * @return VectorBatch<VectorType>&
+             */
+            template<Expressions::BatchExpressionOf<VectorType> Expression>
+            VectorBatch<VectorType>& operator=(const Expression& expression)
+            noexcept
+            {
+                this->Evaluate(expression);
+                return *this;
+            }
+
+        private:
+
+            /**
+             * @brief Writes what expression evaluates to into this batch
+             * @details
+             * An operation straight on two batches (`a + b`,
+             * `a.Reflection(b)`) that store their vectors the same way goes
+             * through BatchKernels and so gets their SIMD paths; anything
+             * bigger, or two batches with different dimensions or
+             * formatting, is one fused loop over the vectors. Both give the
+             * same numbers.
+             *
+             * @tparam Expression
+             * @param expression
+             */
+            template<typename Expression>
+            void Evaluate(const Expression& expression) noexcept
+            {
+                FluidEngineZone("VectorBatch::Evaluate");
+
+                this->dimensions = expression.GetDimensions();
+                this->formatting = expression.GetFormatting();
+                this->Resize(expression.Size());
+
+                const std::size_t used = this->UsedColumns();
+
+                if constexpr
+                (
+                    Expressions::IsBatchElementwise<Expression>::value
+                )
+                {
+                    if
+                    (
+                        expression.lhs.batch.IsLaidOutLike
+                        (
+                            expression.rhs.batch
+                        )
+                    )
+                    {
+                        this->EvaluateWithKernels
+                        <
+                            typename Expression::Applied
+                        >
+                        (
+                            expression.lhs.batch,
+                            expression.rhs.batch,
+                            used
+                        );
+                    }
+                    else
+                    {
+                        this->EvaluateEach(expression, used);
+                    }
+                }
+                else if constexpr
+                (
+                    Expressions::IsBatchReflection<Expression>::value
+                )
+                {
+                    if
+                    (
+                        expression.reflects &&
+                        expression.direction.batch.IsLaidOutLike
+                        (
+                            expression.normal.batch
+                        )
+                    )
+                    {
+                        const auto& directions = expression.direction.batch;
+                        const auto& normals = expression.normal.batch;
+
+                        BatchKernels::Reflect<VectorType>
+                        (
+                            {
+                                directions.GetColumn(0),
+                                directions.GetColumn(1),
+                                used == 3 ?
+                                    directions.GetColumn(2) :
+                                    std::span<const VectorType>()
+                            },
+                            {
+                                normals.GetColumn(0),
+                                normals.GetColumn(1),
+                                used == 3 ?
+                                    normals.GetColumn(2) :
+                                    std::span<const VectorType>()
+                            },
+                            {
+                                this->GetColumn(0),
+                                this->GetColumn(1),
+                                this->GetColumn(2)
+                            }
+                        );
+                    }
+                    else
+                    {
+                        this->EvaluateEach(expression, used);
+                    }
+                }
+                else
+                {
+                    this->EvaluateEach(expression, used);
+                }
+
+                // only now, the expression may still read it
+                if (used == 2)
+                {
+                    this->columns[2].clear();
+                }
+            }
+
+            /**
+             * @brief The BatchKernels path of Evaluate for + - * and /
+             * @note lhs and rhs must store their vectors like this batch
+             *
+             * @tparam Operation Sum, Difference, Product or Quotient
+             * @param lhs
+             * @param rhs
+             * @param used how many columns to write
+             */
+            template<typename Operation>
+            void EvaluateWithKernels
+            (
+                const VectorBatch<VectorType>& lhs,
+                const VectorBatch<VectorType>& rhs,
+                const std::size_t& used
+            ) noexcept
+            {
+                for (std::size_t column = 0; column < used; ++column)
+                {
+                    const auto left = lhs.GetColumn(column);
+                    const auto right = rhs.GetColumn(column);
+                    const auto result = this->GetColumn(column);
+
+                    if constexpr
+                    (
+                        std::is_same<Operation, Expressions::Sum>::value
+                    )
+                    {
+                        BatchKernels::Add<VectorType>(left, right, result);
+                    }
+                    else if constexpr
+                    (
+                        std::is_same
+                        <
+                            Operation,
+                            Expressions::Difference
+                        >::value
+                    )
+                    {
+                        BatchKernels::Subtract<VectorType>
+                        (
+                            left, right, result
+                        );
+                    }
+                    else if constexpr
+                    (
+                        std::is_same
+                        <
+                            Operation,
+                            Expressions::Product
+                        >::value
+                    )
+                    {
+                        BatchKernels::Multiply<VectorType>
+                        (
+                            left, right, result
+                        );
+                    }
+                    else
+                    {
+                        BatchKernels::Divide<VectorType>
+                        (
+                            left, right, result
+                        );
+                    }
+                }
+            }
+
+            /**
+             * @brief The fused loop of Evaluate: every vector is evaluated
+             * through the whole expression tree and written out once
+             *
+             * @tparam Expression
+             * @param expression
+             * @param used how many columns to write
+             */
+            template<typename Expression>
+            void EvaluateEach
+            (
+                const Expression& expression,
+                const std::size_t& used
+            ) noexcept
+            {
+                VectorType* const x = this->columns[0].data();
+                VectorType* const y = this->columns[1].data();
+                VectorType* const z = this->columns[2].data();
+                const std::size_t count = this->Size();
+
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    const Expressions::Coordinates<VectorType> coordinates =
+                        expression.Evaluate(index);
+
+                    x[index] = coordinates[0];
+                    y[index] = coordinates[1];
+                    if (used == 3)
+                    {
+                        z[index] = coordinates[2];
+                    }
+                }
+            }
+        };
+
+    } // namespace Mathematics
+
+} // namespace FluidEngine
+
+
+#endif
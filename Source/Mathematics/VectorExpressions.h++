@@ -0,0 +1,824 @@
+/**
+ * @file VectorExpressions.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the lazy expression templates behind VectorBase and
+ * VectorBatch arithmetic
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef VectorExpressionsFile
+#define VectorExpressionsFile
+
+#include "Tensor.h++"
+#include "../Abstraction/Identity.h++"
+#include "../Concepts/Concepts.h++"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace FluidEngine
+{
+    namespace Mathematics
+    {
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        class VectorBatch;
+
+        /**
+         * @brief Lazy vector arithmetic
+         * @details
+         * `a + b * c - d.Reflection(n)` does not compute anything by itself:
+         * every operator returns a small node that remembers its operands,
+         * and the whole tree is evaluated in one pass, coordinate triple by
+         * coordinate triple, once it is turned into a VectorBase or a
+         * VectorBatch. No intermediate VectorBase (with its name and
+         * identification number) or intermediate batch (with its columns)
+         * is ever made.
+         *
+         * Every node does its math in the same order the eager version
+         * would, so the result is bit for bit the same as evaluating the
+         * expression one operation at a time.
+         *
+         * Operands can be VectorBases, VectorBatches, other nodes and, for
+         * `*` and `/`, plain numbers. A VectorBase in a batch expression
+         * applies to every vector of the batch (`positions + gravity * dt`).
+         * The result gets the name, dimensions and formatting of the
+         * leftmost vector operand, and as many vectors as the smallest
+         * batch operand.
+         *
+         * Operands are not required to match. A 2 dimensional operand's z
+         * reads as quiet NaN, so mixing it with a 3 dimensional one gives
+         * NaN z (or drops the z when the 2 dimensional one is leftmost).
+         * Nothing is converted between formattings: a polar operand mixed
+         * with a rectangular one is combined coordinate by coordinate, as
+         * raw numbers.
+         *
+         * @warning Nodes only hold references to their vector operands.
+         * Turn an expression into a VectorBase or VectorBatch in the
+         * statement that builds it; keeping one around with `auto` dangles
+         * as soon as a temporary operand goes away.
+         */
+        namespace Expressions
+        {
+            /**
+             * @brief x, y, z (or r, theta, phi) of one vector while it is
+             * being evaluated
+             *
+             * @tparam Floating
+             */
+            template<typename Floating>
+            using Coordinates = std::array<Floating, 3>;
+
+            /**
+             * @brief The "size" of something that is the same for every
+             * index (a single VectorBase, a number)
+             *
+             */
+            inline constexpr std::size_t broadcastSize =
+                std::numeric_limits<std::size_t>::max();
+
+            /**
+             * @brief Base of every expression node, so that they can be
+             * told apart from everything else
+             *
+             */
+            struct ExpressionTag
+            {
+            };
+
+            /**
+             * @brief A single VectorBase used in an expression
+             *
+             * @tparam Floating
+             */
+            template<typename Floating>
+            struct VectorReference
+            {
+                using Value = Floating;
+                static constexpr bool IsScalar = false;
+                static constexpr bool HasBatch = false;
+
+                const VectorBase<Floating>& vector;
+                const Coordinates<Floating>& coordinates;
+
+                VectorReference(const VectorBase<Floating>& vector) noexcept
+                : vector(vector), coordinates(vector.GetCoordinates())
+                {
+                    /*Intentionally left blank*/
+                }
+
+                Coordinates<Floating> Evaluate(const std::size_t&)
+                const noexcept
+                {
+                    return this->coordinates;
+                }
+                std::size_t Size() const noexcept
+                {
+                    return broadcastSize;
+                }
+                VectorDimensions GetDimensions() const noexcept
+                {
+                    return this->vector.GetDimensions();
+                }
+                VectorFormatting GetFormatting() const noexcept
+                {
+                    return this->vector.GetFormatting();
+                }
+                Abstraction::NameHandle GetNameHandle() const noexcept
+                {
+                    return this->vector.GetNameHandle();
+                }
+            };
+
+            /**
+             * @brief A VectorBatch used in an expression. The third
+             * coordinate of a 2 dimensional batch reads as quiet NaN, just
+             * like VectorBatch::Export.
+             *
+             * @tparam Floating
+             */
+            template<typename Floating>
+            struct BatchReference
+            {
+                using Value = Floating;
+                static constexpr bool IsScalar = false;
+                static constexpr bool HasBatch = true;
+
+                const VectorBatch<Floating>& batch;
+                const Floating* columns[3];
+                std::size_t size;
+
+                BatchReference(const VectorBatch<Floating>& batch) noexcept
+                : batch(batch),
+                  columns
+                  {
+                      batch.GetColumn(0).data(),
+                      batch.GetColumn(1).data(),
+                      batch.GetDimensions() == VectorDimensions::D3 ?
+                          batch.GetColumn(2).data() :
+                          nullptr
+                  },
+                  size(batch.Size())
+                {
+                    /*Intentionally left blank*/
+                }
+
+                Coordinates<Floating> Evaluate(const std::size_t& index)
+                const noexcept
+                {
+                    return
+                    {
+                        this->columns[0][index],
+                        this->columns[1][index],
+                        this->columns[2] ?
+                            this->columns[2][index] :
+                            std::numeric_limits<Floating>::quiet_NaN()
+                    };
+                }
+                std::size_t Size() const noexcept
+                {
+                    return this->size;
+                }
+                VectorDimensions GetDimensions() const noexcept
+                {
+                    return this->batch.GetDimensions();
+                }
+                VectorFormatting GetFormatting() const noexcept
+                {
+                    return this->batch.GetFormatting();
+                }
+                Abstraction::NameHandle GetNameHandle() const noexcept
+                {
+                    return this->batch.GetNameHandle();
+                }
+            };
+
+            /**
+             * @brief A plain number used in an expression; it is the same
+             * for every coordinate of every vector
+             *
+             * @tparam Floating
+             */
+            template<typename Floating>
+            struct ScalarOperand
+            {
+                using Value = Floating;
+                static constexpr bool IsScalar = true;
+                static constexpr bool HasBatch = false;
+
+                Floating value;
+
+                Coordinates<Floating> Evaluate(const std::size_t&)
+                const noexcept
+                {
+                    return {this->value, this->value, this->value};
+                }
+                std::size_t Size() const noexcept
+                {
+                    return broadcastSize;
+                }
+            };
+
+            /**
+             * @brief lhs + rhs
+             *
+             */
+            struct Sum
+            {
+                template<typename Floating>
+                requires Concepts::Operators::Addable<Floating, Floating>
+                static Floating Apply(const Floating& lhs, const Floating& rhs)
+                noexcept
+                {
+                    return lhs + rhs;
+                }
+            };
+
+            /**
+             * @brief lhs - rhs
+             *
+             */
+            struct Difference
+            {
+                template<typename Floating>
+                requires Concepts::Operators::Subtractable<Floating, Floating>
+                static Floating Apply(const Floating& lhs, const Floating& rhs)
+                noexcept
+                {
+                    return lhs - rhs;
+                }
+            };
+
+            /**
+             * @brief lhs * rhs
+             *
+             */
+            struct Product
+            {
+                template<typename Floating>
+                requires Concepts::Operators::Multiplicable<Floating, Floating>
+                static Floating Apply(const Floating& lhs, const Floating& rhs)
+                noexcept
+                {
+                    return lhs * rhs;
+                }
+            };
+
+            /**
+             * @brief lhs / rhs
+             *
+             */
+            struct Quotient
+            {
+                template<typename Floating>
+                requires Concepts::Operators::Divisable<Floating, Floating>
+                static Floating Apply(const Floating& lhs, const Floating& rhs)
+                noexcept
+                {
+                    return lhs / rhs;
+                }
+            };
+
+            /**
+             * @brief What every node has in common: its result can become
+             * a VectorBase (if no batch is involved)
+             *
+             * @tparam Node the node deriving from this
+             * @tparam Floating
+             */
+            template<typename Node, typename Floating>
+            struct Expression : public ExpressionTag
+            {
+                using Value = Floating;
+                static constexpr bool IsScalar = false;
+
+                /**
+                 * @brief Evaluates the expression into a VectorBase
+                 * @note Only exists for expressions without a VectorBatch
+                 * in them; batch expressions become VectorBatches.
+                 * @author Joshua Buchanan
+                 * @return VectorBase<Floating>
+                 */
+                operator VectorBase<Floating>() const noexcept
+                requires (!Node::HasBatch)
+                {
+                    const Node& node = static_cast<const Node&>(*this);
+                    const Coordinates<Floating> coordinates = node.Evaluate(0);
+
+                    return VectorBase<Floating>
+                    (
+                        node.GetNameHandle(),
+                        node.GetDimensions(),
+                        node.GetFormatting(),
+                        coordinates[0],
+                        coordinates[1],
+                        node.GetDimensions() == VectorDimensions::D3 ?
+                            coordinates[2] :
+                            std::numeric_limits<Floating>::quiet_NaN()
+                    );
+                }
+            };
+
+            /**
+             * @brief Applies Operation coordinate by coordinate
+             *
+             * @tparam LHS
+             * @tparam RHS
+             * @tparam Operation Sum, Difference, Product or Quotient
+             */
+            template<typename LHS, typename RHS, typename Operation>
+            struct ElementwiseExpression :
+                public Expression
+                <
+                    ElementwiseExpression<LHS, RHS, Operation>,
+                    typename LHS::Value
+                >
+            {
+                using Value = typename LHS::Value;
+                using Left = LHS;
+                using Right = RHS;
+                using Applied = Operation;
+                static constexpr bool HasBatch =
+                    LHS::HasBatch || RHS::HasBatch;
+
+                LHS lhs;
+                RHS rhs;
+
+                ElementwiseExpression(const LHS& lhs, const RHS& rhs) noexcept
+                : lhs(lhs), rhs(rhs)
+                {
+                    /*Intentionally left blank*/
+                }
+
+                Coordinates<Value> Evaluate(const std::size_t& index)
+                const noexcept
+                {
+                    const Coordinates<Value> left = this->lhs.Evaluate(index);
+                    const Coordinates<Value> right = this->rhs.Evaluate(index);
+
+                    return
+                    {
+                        Operation::Apply(left[0], right[0]),
+                        Operation::Apply(left[1], right[1]),
+                        Operation::Apply(left[2], right[2])
+                    };
+                }
+                std::size_t Size() const noexcept
+                {
+                    return std::min(this->lhs.Size(), this->rhs.Size());
+                }
+
+                // the leftmost vector operand decides what the result is
+                VectorDimensions GetDimensions() const noexcept
+                {
+                    if constexpr (LHS::IsScalar)
+                    {
+                        return this->rhs.GetDimensions();
+                    }
+                    else
+                    {
+                        return this->lhs.GetDimensions();
+                    }
+                }
+                VectorFormatting GetFormatting() const noexcept
+                {
+                    if constexpr (LHS::IsScalar)
+                    {
+                        return this->rhs.GetFormatting();
+                    }
+                    else
+                    {
+                        return this->lhs.GetFormatting();
+                    }
+                }
+                Abstraction::NameHandle GetNameHandle() const noexcept
+                {
+                    if constexpr (LHS::IsScalar)
+                    {
+                        return this->rhs.GetNameHandle();
+                    }
+                    else
+                    {
+                        return this->lhs.GetNameHandle();
+                    }
+                }
+            };
+
+            /**
+             * @brief Reflects direction about the (unit) normal:
+             * d - 2 (d . n) n
+             * @note Same math, in the same order, as BatchKernels::Reflect.
+             * Polar directions or normals, and 3D directions with 2D normals,
+             * are not reflected at all (you get the direction back).
+             *
+             * @tparam Direction
+             * @tparam Normal
+             */
+            template<typename Direction, typename Normal>
+            struct ReflectionExpression :
+                public Expression
+                <
+                    ReflectionExpression<Direction, Normal>,
+                    typename Direction::Value
+                >
+            {
+                using Value = typename Direction::Value;
+                using Directions = Direction;
+                using Normals = Normal;
+                static constexpr bool HasBatch =
+                    Direction::HasBatch || Normal::HasBatch;
+
+                Direction direction;
+                Normal normal;
+                bool reflects;
+                bool threeDimensional;
+
+                ReflectionExpression
+                (
+                    const Direction& direction,
+                    const Normal& normal
+                ) noexcept
+                : direction(direction), normal(normal)
+                {
+                    this->threeDimensional =
+                        direction.GetDimensions() == VectorDimensions::D3;
+                    this->reflects =
+                        direction.GetFormatting() == VectorFormatting::Rct &&
+                        normal.GetFormatting() == VectorFormatting::Rct &&
+                        !(
+                            this->threeDimensional &&
+                            normal.GetDimensions() == VectorDimensions::D2
+                        );
+                }
+
+                Coordinates<Value> Evaluate(const std::size_t& index)
+                const noexcept
+                {
+                    const Coordinates<Value> d = this->direction.Evaluate
+                    (
+                        index
+                    );
+                    if (!this->reflects)
+                    {
+                        return d;
+                    }
+                    const Coordinates<Value> n = this->normal.Evaluate(index);
+
+                    Value dot = d[0] * n[0] + d[1] * n[1];
+                    if (this->threeDimensional)
+                    {
+                        dot = dot + d[2] * n[2];
+                    }
+                    const Value scale = 2 * dot;
+
+                    return
+                    {
+                        d[0] - scale * n[0],
+                        d[1] - scale * n[1],
+                        d[2] - scale * n[2]
+                    };
+                }
+                std::size_t Size() const noexcept
+                {
+                    return std::min
+                    (
+                        this->direction.Size(),
+                        this->normal.Size()
+                    );
+                }
+                VectorDimensions GetDimensions() const noexcept
+                {
+                    return this->direction.GetDimensions();
+                }
+                VectorFormatting GetFormatting() const noexcept
+                {
+                    return this->direction.GetFormatting();
+                }
+                Abstraction::NameHandle GetNameHandle() const noexcept
+                {
+                    return this->direction.GetNameHandle();
+                }
+            };
+
+            /**
+             * @brief How something is held when it is used in an expression
+             * @note Not specialized means it cannot be an operand.
+             *
+             * @tparam Type
+             */
+            template<typename Type>
+            struct OperandTraits
+            {
+                static constexpr bool IsOperand = false;
+            };
+            template<typename Floating>
+            struct OperandTraits<VectorBase<Floating>>
+            {
+                static constexpr bool IsOperand = true;
+                using Value = Floating;
+                using Held = VectorReference<Floating>;
+            };
+            template<typename Floating>
+            struct OperandTraits<VectorBatch<Floating>>
+            {
+                static constexpr bool IsOperand = true;
+                using Value = Floating;
+                using Held = BatchReference<Floating>;
+            };
+            template<typename Node>
+            requires std::is_base_of<ExpressionTag, Node>::value
+            struct OperandTraits<Node>
+            {
+                static constexpr bool IsOperand = true;
+                using Value = typename Node::Value;
+                using Held = Node;
+            };
+
+            /**
+             * @brief Checks if Type can be an operand of an expression (a
+             * VectorBase, a VectorBatch or another expression)
+             *
+             * @tparam Type
+             */
+            template<typename Type>
+            concept Operand =
+                OperandTraits<std::remove_cvref_t<Type>>::IsOperand;
+
+            /**
+             * @brief The Floating of an operand
+             *
+             * @tparam Type
+             */
+            template<Operand Type>
+            using ValueOf =
+                typename OperandTraits<std::remove_cvref_t<Type>>::Value;
+
+            /**
+             * @brief How an operand is held in an expression
+             *
+             * @tparam Type
+             */
+            template<Operand Type>
+            using HeldAs =
+                typename OperandTraits<std::remove_cvref_t<Type>>::Held;
+
+            /**
+             * @brief Checks if two operands can be combined (they have to
+             * have the same precision)
+             *
+             * @tparam LHS
+             * @tparam RHS
+             */
+            template<typename LHS, typename RHS>
+            concept Combinable = Operand<LHS> && Operand<RHS> &&
+                std::is_same<ValueOf<LHS>, ValueOf<RHS>>::value;
+
+            /**
+             * @brief Checks if Number can scale the vector operand Type
+             *
+             * @tparam Number
+             * @tparam Type
+             */
+            template<typename Number, typename Type>
+            concept ScalingOf = Operand<Type> &&
+                std::is_arithmetic<std::remove_cvref_t<Number>>::value;
+
+            /**
+             * @brief Checks if Type is an expression (or VectorBatch) that
+             * evaluates into a VectorBatch of Floating
+             *
+             * @tparam Type
+             * @tparam Floating
+             */
+            template<typename Type, typename Floating>
+            concept BatchExpressionOf =
+                std::is_base_of<ExpressionTag, Type>::value &&
+                std::is_same<typename Type::Value, Floating>::value &&
+                Type::HasBatch;
+
+            /**
+             * @brief Checks if Node is one operation straight on two
+             * batches (which BatchKernels has a kernel for)
+             *
+             * @tparam Node
+             */
+            template<typename Node>
+            struct IsBatchElementwise : public std::false_type
+            {
+            };
+            template<typename Floating, typename Operation>
+            struct IsBatchElementwise
+            <
+                ElementwiseExpression
+                <
+                    BatchReference<Floating>,
+                    BatchReference<Floating>,
+                    Operation
+                >
+            > : public std::true_type
+            {
+            };
+
+            /**
+             * @brief Checks if Node is a reflection straight on two batches
+             * (which BatchKernels has a kernel for)
+             *
+             * @tparam Node
+             */
+            template<typename Node>
+            struct IsBatchReflection : public std::false_type
+            {
+            };
+            template<typename Floating>
+            struct IsBatchReflection
+            <
+                ReflectionExpression
+                <
+                    BatchReference<Floating>,
+                    BatchReference<Floating>
+                >
+            > : public std::true_type
+            {
+            };
+
+            /**
+             * @brief Adds vectors coordinate by coordinate
+             * @note The operands' dimensions and formatting are not
+             * checked; see the namespace documentation for what mixing them
+             * does.
+             * @author Joshua Buchanan
+             * @return an expression
+             */
+            template<typename LHS, typename RHS>
+            requires Combinable<LHS, RHS> &&
+                Concepts::Operators::Addable<ValueOf<LHS>, ValueOf<RHS>>
+            inline ElementwiseExpression<HeldAs<LHS>, HeldAs<RHS>, Sum>
+            operator+(const LHS& lhs, const RHS& rhs) noexcept
+            {
+                return {HeldAs<LHS>{lhs}, HeldAs<RHS>{rhs}};
+            }
+
+            /**
+             * @brief Subtracts vectors coordinate by coordinate
+             * @note The operands' dimensions and formatting are not
+             * checked; see the namespace documentation for what mixing them
+             * does.
+             * @author Joshua Buchanan
+             * @return an expression
+             */
+            template<typename LHS, typename RHS>
+            requires Combinable<LHS, RHS> &&
+                Concepts::Operators::Subtractable<ValueOf<LHS>, ValueOf<RHS>>
+            inline ElementwiseExpression<HeldAs<LHS>, HeldAs<RHS>, Difference>
+            operator-(const LHS& lhs, const RHS& rhs) noexcept
+            {
+                return {HeldAs<LHS>{lhs}, HeldAs<RHS>{rhs}};
+            }
+
+            /**
+             * @brief Multiplies vectors coordinate by coordinate
+             * @note The operands' dimensions and formatting are not
+             * checked; see the namespace documentation for what mixing them
+             * does.
+             * @author Joshua Buchanan
+             * @return an expression
+             */
+            template<typename LHS, typename RHS>
+            requires Combinable<LHS, RHS> &&
+                Concepts::Operators::Multiplicable<ValueOf<LHS>, ValueOf<RHS>>
+            inline ElementwiseExpression<HeldAs<LHS>, HeldAs<RHS>, Product>
+            operator*(const LHS& lhs, const RHS& rhs) noexcept
+            {
+                return {HeldAs<LHS>{lhs}, HeldAs<RHS>{rhs}};
+            }
+
+            /**
+             * @brief Scales a vector
+             * @author Joshua Buchanan
+             * @return an expression
+             */
+            template<typename LHS, typename Number>
+            requires ScalingOf<Number, LHS> &&
+                Concepts::Operators::Multiplicable<ValueOf<LHS>, ValueOf<LHS>>
+            inline ElementwiseExpression
+            <
+                HeldAs<LHS>,
+                ScalarOperand<ValueOf<LHS>>,
+                Product
+            >
+            operator*(const LHS& lhs, const Number& rhs) noexcept
+            {
+                return
+                {
+                    HeldAs<LHS>{lhs},
+                    ScalarOperand<ValueOf<LHS>>{(ValueOf<LHS>)rhs}
+                };
+            }
+
+            /**
+             * @brief Scales a vector
+             * @author Joshua Buchanan
+             * @return an expression
+             */
+            template<typename Number, typename RHS>
+            requires ScalingOf<Number, RHS> &&
+                Concepts::Operators::Multiplicable<ValueOf<RHS>, ValueOf<RHS>>
+            inline ElementwiseExpression
+            <
+                ScalarOperand<ValueOf<RHS>>,
+                HeldAs<RHS>,
+                Product
+            >
+            operator*(const Number& lhs, const RHS& rhs) noexcept
+            {
+                return
+                {
+                    ScalarOperand<ValueOf<RHS>>{(ValueOf<RHS>)lhs},
+                    HeldAs<RHS>{rhs}
+                };
+            }
+
+            /**
+             * @brief Divides vectors coordinate by coordinate
+             * @note The operands' dimensions and formatting are not
+             * checked; see the namespace documentation for what mixing them
+             * does.
+             * @author Joshua Buchanan
+             * @return an expression
+             */
+            template<typename LHS, typename RHS>
+            requires Combinable<LHS, RHS> &&
+                Concepts::Operators::Divisable<ValueOf<LHS>, ValueOf<RHS>>
+            inline ElementwiseExpression<HeldAs<LHS>, HeldAs<RHS>, Quotient>
+            operator/(const LHS& lhs, const RHS& rhs) noexcept
+            {
+                return {HeldAs<LHS>{lhs}, HeldAs<RHS>{rhs}};
+            }
+
+            /**
+             * @brief Divides every coordinate of a vector by a number
+             * @note Divides, rather than multiplying by the reciprocal, so
+             * that the result matches dividing one by one.
+             * @author Joshua Buchanan
+             * @return an expression
+             */
+            template<typename LHS, typename Number>
+            requires ScalingOf<Number, LHS> &&
+                Concepts::Operators::Divisable<ValueOf<LHS>, ValueOf<LHS>>
+            inline ElementwiseExpression
+            <
+                HeldAs<LHS>,
+                ScalarOperand<ValueOf<LHS>>,
+                Quotient
+            >
+            operator/(const LHS& lhs, const Number& rhs) noexcept
+            {
+                return
+                {
+                    HeldAs<LHS>{lhs},
+                    ScalarOperand<ValueOf<LHS>>{(ValueOf<LHS>)rhs}
+                };
+            }
+
+            /**
+             * @brief Reflects direction about the (unit) normal, for any
+             * two operands (VectorBase::Reflection and
+             * VectorBatch::Reflection only take their own type)
+             * @note Only two rectangular operands are reflected, and a 3
+             * dimensional direction needs a 3 dimensional normal; otherwise
+             * the direction comes back as it is. A 2 dimensional direction
+             * uses the x and y of a 3 dimensional normal.
+             * @author Joshua Buchanan
+             * @return an expression
+             */
+            template<typename Direction, typename Normal>
+            requires Combinable<Direction, Normal>
+            inline ReflectionExpression<HeldAs<Direction>, HeldAs<Normal>>
+            Reflection(const Direction& direction, const Normal& normal)
+            noexcept
+            {
+                return {HeldAs<Direction>{direction}, HeldAs<Normal>{normal}};
+            }
+
+        } // namespace Expressions
+
+        // so that argument dependent lookup finds them for VectorBase and
+        // VectorBatch operands too
+        using Expressions::operator+;
+        using Expressions::operator-;
+        using Expressions::operator*;
+        using Expressions::operator/;
+        using Expressions::Reflection;
+
+    } // namespace Mathematics
+
+} // namespace FluidEngine
+
+
+#endif
@@ -0,0 +1,977 @@
+/**
+ * @file Snapshot.c++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the stuff for Snapshot.h++
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#include "Snapshot.h++"
+
+#include "../Diagnostics/Instrumentation.h++"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace FluidEngine::Serialization;
+using FluidEngine::Abstraction::Acknowledgement;
+using FluidEngine::Mathematics::VectorDimensions;
+using FluidEngine::Mathematics::VectorFormatting;
+
+/**
+ * @brief What every snapshot starts with. The \r\n catches files that went
+ * through a text mode transfer.
+ *
+ */
+static constexpr char snapshotMagic[8] = {'F', 'E', 'S', 'N', 'A', 'P', '\r',
+    '\n'};
+
+/**
+ * @brief Whether snapshots can be written and mapped here at all
+ *
+ */
+static constexpr bool platformSupported =
+#if defined(__unix__) || defined(__APPLE__)
+    std::endian::native == std::endian::little;
+#else
+    false;
+#endif
+
+/**
+ * @brief How many bytes of a Floating hold its value (the rest of its slot
+ * is padding, written as 0)
+ *
+ */
+template<typename Floating>
+static constexpr std::size_t valueBytes =
+    scalarKindOf<Floating> == ScalarKind::Extended80 ? 10 : sizeof(Floating);
+
+/**
+ * @brief Rounds offset up to the next multiple of snapshotAlignment
+ * @author Joshua Buchanan
+ */
+static constexpr std::uint64_t AlignedUp(const std::uint64_t& offset) noexcept
+{
+    return (offset + snapshotAlignment - 1) / snapshotAlignment *
+        snapshotAlignment;
+}
+
+/**
+ * @brief Puts the parts of a snapshot with room for room vectors one after
+ * another, each at the next multiple of snapshotAlignment
+ * @author Joshua Buchanan
+ */
+template<typename Floating>
+static void LayOut(SnapshotHeader& header, const std::uint64_t& room)
+noexcept
+{
+    const std::uint64_t columnSize = sizeof(Floating) * room;
+    header.nameIndexOffset = AlignedUp(sizeof(SnapshotHeader));
+    header.tagOffset = AlignedUp
+    (
+        header.nameIndexOffset + sizeof(std::uint32_t) * room
+    );
+    header.columnOffsets[0] = AlignedUp(header.tagOffset + room);
+    header.columnOffsets[1] = AlignedUp(header.columnOffsets[0] + columnSize);
+    header.columnOffsets[2] = AlignedUp(header.columnOffsets[1] + columnSize);
+    header.nameTableOffset = AlignedUp(header.columnOffsets[2] + columnSize);
+}
+
+/**
+ * @brief 64 bit FNV-1a, continuing from hash
+ * @author Joshua Buchanan
+ */
+static std::uint64_t Hash
+(
+    const void* bytes,
+    const std::size_t& size,
+    std::uint64_t hash = 14695981039346656037ull
+) noexcept
+{
+    const unsigned char* byte = static_cast<const unsigned char*>(bytes);
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        hash = (hash ^ byte[index]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/**
+ * @brief The checksum a header with this name table should have
+ * @author Joshua Buchanan
+ */
+static std::uint64_t Checksum
+(
+    SnapshotHeader header,
+    const void* nameTable
+) noexcept
+{
+    header.checksum = 0;
+    return Hash
+    (
+        nameTable,
+        header.nameTableSize,
+        Hash(&header, sizeof(header))
+    );
+}
+
+/**
+ * @brief Packs the dimensions and formatting of a vector into a tag
+ * @author Joshua Buchanan
+ */
+static std::uint8_t Tag
+(
+    const VectorDimensions& dimensions,
+    const VectorFormatting& formatting
+) noexcept
+{
+    return (dimensions == VectorDimensions::D3 ? 1 : 0) |
+        (formatting == VectorFormatting::Rct ? 2 : 0);
+}
+
+//-----------------------------------------------------------------------------
+// The only platform specific part: files and mappings
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Creates (or empties) a file for writing
+ * @return int the descriptor, negative on failure
+ */
+static int CreateFile(const std::string& path) noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    return ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Writes all of bytes at offset
+ * @return true if it all got written
+ */
+static bool WriteFully
+(
+    const int& file,
+    const void* bytes,
+    std::size_t size,
+    std::uint64_t offset
+) noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    const char* next = static_cast<const char*>(bytes);
+    while (size > 0)
+    {
+        const ssize_t done = ::pwrite(file, next, size, (off_t)offset);
+        if (done <= 0)
+        {
+            return false;
+        }
+        next += done;
+        size -= (std::size_t)done;
+        offset += (std::uint64_t)done;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Reads all of size bytes at offset
+ * @return true if it all got read
+ */
+static bool ReadFully
+(
+    const int& file,
+    void* bytes,
+    std::size_t size,
+    std::uint64_t offset
+) noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    char* next = static_cast<char*>(bytes);
+    while (size > 0)
+    {
+        const ssize_t done = ::pread(file, next, size, (off_t)offset);
+        if (done <= 0)
+        {
+            return false;
+        }
+        next += done;
+        size -= (std::size_t)done;
+        offset += (std::uint64_t)done;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Cuts or extends a file to size bytes, then closes it
+ * @return true if both worked
+ */
+static bool FinishFile(const int& file, const std::uint64_t& size) noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    const bool truncated = ::ftruncate(file, (off_t)size) == 0;
+    return ::close(file) == 0 && truncated;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Maps a whole file, read only
+ * @param size where to put the size of the mapping
+ * @return const unsigned char* nullptr on failure (or for an empty file)
+ */
+static const unsigned char* MapFile
+(
+    const std::string& path,
+    std::size_t& size
+) noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    const int file = ::open(path.c_str(), O_RDONLY);
+    if (file < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat status;
+    void* mapping = MAP_FAILED;
+    if (::fstat(file, &status) == 0 && status.st_size > 0)
+    {
+        size = (std::size_t)status.st_size;
+        mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+    }
+    // the mapping stays valid without the descriptor
+    ::close(file);
+
+    return mapping == MAP_FAILED ?
+        nullptr : static_cast<const unsigned char*>(mapping);
+#else
+    return nullptr;
+#endif
+}
+
+/**
+ * @brief Undoes MapFile
+ */
+static void UnmapFile
+(
+    const unsigned char* mapping,
+    const std::size_t& size
+) noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    ::munmap(const_cast<unsigned char*>(mapping), size);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// SnapshotWriter
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a SnapshotWriter that is not writing anything yet
+ * @author Joshua Buchanan
+ * @param writerName the name of the writer
+ *
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+SnapshotWriter<Precision>::SnapshotWriter(const std::wstring& writerName)
+noexcept
+: Abstraction::FluidEngineMember(writerName),
+  file(-1),
+  failed(false),
+  header{},
+  capacity(0),
+  count(0),
+  written(0)
+{
+    /*Intentionally left blank*/
+}
+
+/**
+ * @brief Constructs a SnapshotWriter that is not writing anything yet
+ * @author Joshua Buchanan
+ *
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+SnapshotWriter<Precision>::SnapshotWriter() noexcept
+: SnapshotWriter(L"Unnamed Snapshot Writer")
+{
+    /*Intentionally left blank*/
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+SnapshotWriter<Precision>::~SnapshotWriter() noexcept
+{
+    this->Close();
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SnapshotWriter<Precision>::Open
+(
+    const std::string& path,
+    const std::size_t& capacity
+) noexcept
+{
+    if
+    (
+        !platformSupported ||
+        scalarKindOf<Precision> == ScalarKind::Unsupported ||
+        this->file >= 0
+    )
+    {
+        return Acknowledgement::Failure;
+    }
+
+    this->file = CreateFile(path);
+    if (this->file < 0)
+    {
+        return Acknowledgement::Failure;
+    }
+
+    this->failed = false;
+    this->capacity = capacity;
+    this->count = 0;
+    this->written = 0;
+    this->nameIndices.clear();
+    this->names.clear();
+
+    this->header = {};
+    std::memcpy(this->header.magic, snapshotMagic, sizeof(snapshotMagic));
+    this->header.version = snapshotVersion;
+    this->header.headerSize = sizeof(SnapshotHeader);
+    this->header.scalarKind = scalarKindOf<Precision>;
+    this->header.scalarSize = sizeof(Precision);
+
+    LayOut<Precision>(this->header, capacity);
+
+    this->bufferedNames.reserve(bufferedVectors);
+    this->bufferedTags.reserve(bufferedVectors);
+    for (auto& column : this->bufferedColumns)
+    {
+        // only ever filled valueBytes at a time, so padding stays 0
+        column.assign(bufferedVectors * sizeof(Precision), 0);
+    }
+    return Acknowledgement::Success;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void SnapshotWriter<Precision>::WriteAt
+(
+    const void* bytes,
+    const std::size_t& size,
+    const std::uint64_t& offset
+) noexcept
+{
+    if (!WriteFully(this->file, bytes, size, offset))
+    {
+        this->failed = true;
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void SnapshotWriter<Precision>::MoveTo(const std::size_t& room) noexcept
+{
+    FluidEngineZone("SnapshotWriter::MoveTo");
+
+    SnapshotHeader moved = this->header;
+    LayOut<Precision>(moved, room);
+
+    struct Part
+    {
+        std::uint64_t from;
+        std::uint64_t to;
+        std::uint64_t size;
+    };
+    const std::array<Part, 5> parts =
+    {{
+        {
+            this->header.nameIndexOffset,
+            moved.nameIndexOffset,
+            this->written * sizeof(std::uint32_t)
+        },
+        {this->header.tagOffset, moved.tagOffset, this->written},
+        {
+            this->header.columnOffsets[0],
+            moved.columnOffsets[0],
+            this->written * sizeof(Precision)
+        },
+        {
+            this->header.columnOffsets[1],
+            moved.columnOffsets[1],
+            this->written * sizeof(Precision)
+        },
+        {
+            this->header.columnOffsets[2],
+            moved.columnOffsets[2],
+            this->written * sizeof(Precision)
+        }
+    }};
+
+    // growing moves every part up, so the last part goes first and each
+    // part is copied from its end, so that nothing is overwritten before
+    // it was read; shrinking is the mirror image of that
+    const bool growing = room > this->capacity;
+    std::vector<unsigned char> block(std::min<std::uint64_t>
+    (
+        movedBytes,
+        this->written * sizeof(Precision)
+    ));
+    for (std::size_t order = 0; order < parts.size(); ++order)
+    {
+        const Part& part = parts[growing ? parts.size() - 1 - order : order];
+        if (part.from == part.to)
+        {
+            continue;
+        }
+        for (std::uint64_t done = 0; done < part.size && !this->failed;)
+        {
+            const std::uint64_t size =
+                std::min<std::uint64_t>(block.size(), part.size - done);
+            const std::uint64_t at = growing ?
+                part.size - done - size : done;
+            if (!ReadFully(this->file, block.data(), size, part.from + at))
+            {
+                this->failed = true;
+            }
+            this->WriteAt(block.data(), size, part.to + at);
+            done += size;
+        }
+    }
+
+    std::memcpy
+    (
+        this->header.columnOffsets,
+        moved.columnOffsets,
+        sizeof(moved.columnOffsets)
+    );
+    this->header.nameIndexOffset = moved.nameIndexOffset;
+    this->header.tagOffset = moved.tagOffset;
+    this->header.nameTableOffset = moved.nameTableOffset;
+    this->capacity = room;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void SnapshotWriter<Precision>::Buffer
+(
+    const Abstraction::NameHandle& name,
+    const VectorDimensions& dimensions,
+    const VectorFormatting& formatting,
+    const std::array<Precision, 3>& coordinates
+) noexcept
+{
+    const auto [found, added] = this->nameIndices.try_emplace
+    (
+        name,
+        (std::uint32_t)this->names.size()
+    );
+    if (added)
+    {
+        this->names.push_back(name);
+    }
+
+    if (this->count == this->capacity)
+    {
+        this->MoveTo(std::max(2 * this->capacity, bufferedVectors));
+    }
+
+    const std::size_t slot = this->count - this->written;
+    this->bufferedNames.push_back(found->second);
+    this->bufferedTags.push_back(Tag(dimensions, formatting));
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        std::memcpy
+        (
+            this->bufferedColumns[axis].data() + slot * sizeof(Precision),
+            &coordinates[axis],
+            valueBytes<Precision>
+        );
+    }
+
+    ++this->count;
+    if (this->count - this->written == bufferedVectors)
+    {
+        this->Flush();
+    }
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void SnapshotWriter<Precision>::Flush() noexcept
+{
+    const std::size_t buffered = this->count - this->written;
+    if (buffered == 0)
+    {
+        return;
+    }
+
+    this->WriteAt
+    (
+        this->bufferedNames.data(),
+        buffered * sizeof(std::uint32_t),
+        this->header.nameIndexOffset + this->written * sizeof(std::uint32_t)
+    );
+    this->WriteAt
+    (
+        this->bufferedTags.data(),
+        buffered,
+        this->header.tagOffset + this->written
+    );
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        this->WriteAt
+        (
+            this->bufferedColumns[axis].data(),
+            buffered * sizeof(Precision),
+            this->header.columnOffsets[axis] +
+                this->written * sizeof(Precision)
+        );
+    }
+
+    this->written = this->count;
+    this->bufferedNames.clear();
+    this->bufferedTags.clear();
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SnapshotWriter<Precision>::Write
+(
+    const Mathematics::VectorBase<Precision>& vector
+) noexcept
+{
+    if (this->file < 0)
+    {
+        return Acknowledgement::Failure;
+    }
+
+    this->Buffer
+    (
+        vector.GetNameHandle(),
+        vector.GetDimensions(),
+        vector.GetFormatting(),
+        vector.GetCoordinates()
+    );
+    return Acknowledgement::Success;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SnapshotWriter<Precision>::Write
+(
+    const Mathematics::VectorBatch<Precision>& batch
+) noexcept
+{
+    if (this->file < 0)
+    {
+        return Acknowledgement::Failure;
+    }
+
+    const bool threeDimensional =
+        batch.GetDimensions() == VectorDimensions::D3;
+    for (std::size_t index = 0; index < batch.Size(); ++index)
+    {
+        this->Buffer
+        (
+            batch.GetNameHandle(),
+            batch.GetDimensions(),
+            batch.GetFormatting(),
+            {
+                batch.GetColumn(0)[index],
+                batch.GetColumn(1)[index],
+                threeDimensional ?
+                    batch.GetColumn(2)[index] :
+                    std::numeric_limits<Precision>::quiet_NaN()
+            }
+        );
+    }
+    return Acknowledgement::Success;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::size_t SnapshotWriter<Precision>::Size() const noexcept
+{
+    return this->count;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SnapshotWriter<Precision>::Close() noexcept
+{
+    if (this->file < 0)
+    {
+        return Acknowledgement::Failure;
+    }
+    FluidEngineZone("SnapshotWriter::Close");
+
+    this->Flush();
+    if (this->capacity != this->count)
+    {
+        this->MoveTo(this->count);
+    }
+
+    // moving leaves old bytes in the padding between parts; a closed
+    // snapshot has zeros there however it was written
+    static constexpr unsigned char zeros[snapshotAlignment] = {};
+    const std::array<std::uint64_t, 5> ends =
+    {
+        this->header.nameIndexOffset + this->count * sizeof(std::uint32_t),
+        this->header.tagOffset + this->count,
+        this->header.columnOffsets[0] + this->count * sizeof(Precision),
+        this->header.columnOffsets[1] + this->count * sizeof(Precision),
+        this->header.columnOffsets[2] + this->count * sizeof(Precision)
+    };
+    const std::array<std::uint64_t, 5> starts =
+    {
+        this->header.tagOffset,
+        this->header.columnOffsets[0],
+        this->header.columnOffsets[1],
+        this->header.columnOffsets[2],
+        this->header.nameTableOffset
+    };
+    for (std::size_t part = 0; part < ends.size(); ++part)
+    {
+        this->WriteAt(zeros, starts[part] - ends[part], ends[part]);
+    }
+
+    std::vector<std::uint32_t> nameTable;
+    for (const Abstraction::NameHandle& name : this->names)
+    {
+        const std::wstring& text = Abstraction::NameTable::Lookup(name);
+        nameTable.push_back((std::uint32_t)text.size());
+        for (const wchar_t& character : text)
+        {
+            nameTable.push_back((std::uint32_t)character);
+        }
+    }
+
+    this->header.nameCount = (std::uint32_t)this->names.size();
+    this->header.vectorCount = this->count;
+    this->header.nameTableSize = nameTable.size() * sizeof(std::uint32_t);
+    this->header.fileSize =
+        this->header.nameTableOffset + this->header.nameTableSize;
+    this->header.checksum = Checksum(this->header, nameTable.data());
+
+    this->WriteAt
+    (
+        nameTable.data(),
+        this->header.nameTableSize,
+        this->header.nameTableOffset
+    );
+    this->WriteAt(&this->header, sizeof(SnapshotHeader), 0);
+    if (!FinishFile(this->file, this->header.fileSize))
+    {
+        this->failed = true;
+    }
+
+    this->file = -1;
+    return this->failed ? Acknowledgement::Failure : Acknowledgement::Success;
+}
+
+//-----------------------------------------------------------------------------
+// SnapshotReader
+//-----------------------------------------------------------------------------
+
+/**
+ * @brief Constructs a SnapshotReader that has nothing open yet
+ * @author Joshua Buchanan
+ * @param readerName the name of the reader
+ *
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+SnapshotReader<Precision>::SnapshotReader(const std::wstring& readerName)
+noexcept
+: Abstraction::FluidEngineMember(readerName),
+  mapping(nullptr),
+  mappingSize(0),
+  header{}
+{
+    /*Intentionally left blank*/
+}
+
+/**
+ * @brief Constructs a SnapshotReader that has nothing open yet
+ * @author Joshua Buchanan
+ *
+ * @tparam Precision the precision to use--float, double, long double, etc.
+ */
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+SnapshotReader<Precision>::SnapshotReader() noexcept
+: SnapshotReader(L"Unnamed Snapshot Reader")
+{
+    /*Intentionally left blank*/
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+SnapshotReader<Precision>::~SnapshotReader() noexcept
+{
+    this->Close();
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SnapshotReader<Precision>::Open(const std::string& path)
+noexcept
+{
+    FluidEngineZone("SnapshotReader::Open");
+
+    this->Close();
+    if
+    (
+        !platformSupported ||
+        scalarKindOf<Precision> == ScalarKind::Unsupported
+    )
+    {
+        return Acknowledgement::Failure;
+    }
+
+    this->mapping = MapFile(path, this->mappingSize);
+    if (this->mapping == nullptr)
+    {
+        this->mappingSize = 0;
+        return Acknowledgement::Failure;
+    }
+
+    if (this->Validate() == Acknowledgement::Failure)
+    {
+        this->Close();
+        return Acknowledgement::Failure;
+    }
+    return Acknowledgement::Success;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+Acknowledgement SnapshotReader<Precision>::Validate() noexcept
+{
+    if (this->mappingSize < sizeof(SnapshotHeader))
+    {
+        return Acknowledgement::Failure;
+    }
+    std::memcpy(&this->header, this->mapping, sizeof(SnapshotHeader));
+    const SnapshotHeader& header = this->header;
+
+    if
+    (
+        std::memcmp(header.magic, snapshotMagic, sizeof(snapshotMagic)) != 0 ||
+        header.version != snapshotVersion ||
+        header.headerSize != sizeof(SnapshotHeader) ||
+        header.scalarKind != scalarKindOf<Precision> ||
+        header.scalarSize != sizeof(Precision) ||
+        header.reserved != 0 ||
+        header.fileSize != this->mappingSize
+    )
+    {
+        return Acknowledgement::Failure;
+    }
+
+    // every part aligned, and inside the file
+    const auto fits = [this]
+    (
+        const std::uint64_t& offset,
+        const std::uint64_t& count,
+        const std::uint64_t& size
+    )
+    {
+        return offset % snapshotAlignment == 0 &&
+            offset <= this->mappingSize &&
+            count <= (this->mappingSize - offset) / size;
+    };
+    if
+    (
+        !fits(header.nameIndexOffset, header.vectorCount, 4) ||
+        !fits(header.tagOffset, header.vectorCount, 1) ||
+        !fits(header.columnOffsets[0], header.vectorCount, sizeof(Precision)) ||
+        !fits(header.columnOffsets[1], header.vectorCount, sizeof(Precision)) ||
+        !fits(header.columnOffsets[2], header.vectorCount, sizeof(Precision)) ||
+        !fits(header.nameTableOffset, header.nameTableSize, 1) ||
+        header.nameTableSize % sizeof(std::uint32_t) != 0
+    )
+    {
+        return Acknowledgement::Failure;
+    }
+
+    const unsigned char* nameTable = this->mapping + header.nameTableOffset;
+    if (Checksum(header, nameTable) != header.checksum)
+    {
+        return Acknowledgement::Failure;
+    }
+
+    const std::size_t words = header.nameTableSize / sizeof(std::uint32_t);
+    const auto word = [nameTable](const std::size_t& index)
+    {
+        std::uint32_t value;
+        std::memcpy(&value, nameTable + index * sizeof(value), sizeof(value));
+        return value;
+    };
+    std::size_t next = 0;
+    for (std::uint32_t name = 0; name < header.nameCount; ++name)
+    {
+        if (next == words || word(next) > words - next - 1)
+        {
+            return Acknowledgement::Failure;
+        }
+        std::wstring text(word(next), L'\0');
+        for (wchar_t& character : text)
+        {
+            character = (wchar_t)word(++next);
+        }
+        ++next;
+        this->names.push_back(Abstraction::NameTable::Intern(text));
+    }
+    if (next != words)
+    {
+        return Acknowledgement::Failure;
+    }
+
+    // the only pass over per vector data: 5 bytes a vector, no coordinates
+    std::uint32_t largestName = 0;
+    for (const std::uint32_t& name : this->GetNameIndices())
+    {
+        largestName = std::max(largestName, name);
+    }
+    std::uint8_t tagBits = 0;
+    for (const std::uint8_t& tag : this->GetTags())
+    {
+        tagBits |= tag;
+    }
+    if
+    (
+        (header.vectorCount > 0 && largestName >= header.nameCount) ||
+        tagBits > 3
+    )
+    {
+        return Acknowledgement::Failure;
+    }
+    return Acknowledgement::Success;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+void SnapshotReader<Precision>::Close() noexcept
+{
+    if (this->mapping != nullptr)
+    {
+        UnmapFile(this->mapping, this->mappingSize);
+    }
+    this->mapping = nullptr;
+    this->mappingSize = 0;
+    this->header = {};
+    this->names.clear();
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::size_t SnapshotReader<Precision>::Size() const noexcept
+{
+    return this->header.vectorCount;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::span<const Precision> SnapshotReader<Precision>::GetColumn
+(
+    const std::size_t& index
+) const noexcept
+{
+    if (this->mapping == nullptr)
+    {
+        return {};
+    }
+    return
+    {
+        reinterpret_cast<const Precision*>
+        (
+            this->mapping + this->header.columnOffsets[index]
+        ),
+        this->header.vectorCount
+    };
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::span<const std::uint32_t> SnapshotReader<Precision>::GetNameIndices()
+const noexcept
+{
+    if (this->mapping == nullptr)
+    {
+        return {};
+    }
+    return
+    {
+        reinterpret_cast<const std::uint32_t*>
+        (
+            this->mapping + this->header.nameIndexOffset
+        ),
+        this->header.vectorCount
+    };
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::span<const std::uint8_t> SnapshotReader<Precision>::GetTags()
+const noexcept
+{
+    if (this->mapping == nullptr)
+    {
+        return {};
+    }
+    return {this->mapping + this->header.tagOffset, this->header.vectorCount};
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+const std::vector<FluidEngine::Abstraction::NameHandle>&
+SnapshotReader<Precision>::GetNames() const noexcept
+{
+    return this->names;
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+FluidEngine::Mathematics::VectorBase<Precision>
+SnapshotReader<Precision>::Export(const std::size_t& index) const noexcept
+{
+    const std::uint8_t tag = this->GetTags()[index];
+    return Mathematics::VectorBase<Precision>
+    (
+        this->names[this->GetNameIndices()[index]],
+        tag & 1 ? VectorDimensions::D3 : VectorDimensions::D2,
+        tag & 2 ? VectorFormatting::Rct : VectorFormatting::Plr,
+        this->GetColumn(0)[index],
+        this->GetColumn(1)[index],
+        this->GetColumn(2)[index]
+    );
+}
+
+template<FluidEngine::Concepts::UsableInVectorBase Precision>
+std::vector<FluidEngine::Mathematics::VectorBase<Precision>>
+SnapshotReader<Precision>::ExportAll() const noexcept
+{
+    std::vector<Mathematics::VectorBase<Precision>> vectors;
+    vectors.reserve(this->Size());
+    for (std::size_t index = 0; index < this->Size(); ++index)
+    {
+        vectors.push_back(this->Export(index));
+    }
+    return vectors;
+}
+
+//-----------------------------------------------------------------------------
+// Explicit instantiations, so that the definitions can live in here
+//-----------------------------------------------------------------------------
+
+template class FluidEngine::Serialization::SnapshotWriter<float>;
+template class FluidEngine::Serialization::SnapshotWriter<double>;
+template class FluidEngine::Serialization::SnapshotWriter<long double>;
+template class FluidEngine::Serialization::SnapshotReader<float>;
+template class FluidEngine::Serialization::SnapshotReader<double>;
+template class FluidEngine::Serialization::SnapshotReader<long double>;
@@ -0,0 +1,432 @@
+/**
+ * @file Snapshot.h++
+ * @author Joshua Buchanan (joshuarobertbuchanan@gmail.com) (github: @Natara1939344)
+ * @brief Defines the snapshot format, a binary file of VectorBases, with
+ * a streaming writer and a memory-mapped reader for it
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * Copyright (C) 2026 Joshua Buchanan
+ *
+ */
+
+#ifndef SnapshotFile
+#define SnapshotFile
+
+#include "../Abstraction/FluidEngineMember.h++"
+#include "../Concepts/Concepts.h++"
+#include "../Mathematics/Tensor.h++"
+#include "../Mathematics/VectorBatch.h++"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FluidEngine
+{
+    namespace Serialization
+    {
+        /**
+         * @brief The version of the snapshot format that this code writes
+         * and reads
+         *
+         */
+        inline constexpr std::uint32_t snapshotVersion = 1;
+
+        /**
+         * @brief Where everything in a snapshot starts is a multiple of this
+         * (a cache line, and a multiple of every SIMD width)
+         *
+         */
+        inline constexpr std::size_t snapshotAlignment = 64;
+
+        /**
+         * @brief How a floating point type is laid out in a snapshot
+         * @author Joshua Buchanan
+         */
+        enum class ScalarKind : std::uint8_t
+        {
+            /**
+             * @brief Not something snapshots can hold
+             *
+             */
+            Unsupported = 0,
+            /**
+             * @brief IEEE 754 binary32 (float)
+             *
+             */
+            Binary32 = 1,
+            /**
+             * @brief IEEE 754 binary64 (double)
+             *
+             */
+            Binary64 = 2,
+            /**
+             * @brief x87 80 bit extended precision, in a 16 byte slot whose
+             * 6 padding bytes are 0 (long double on x86-64)
+             *
+             */
+            Extended80 = 3
+        };
+
+        /**
+         * @brief Which ScalarKind Floating is on this platform
+         * @author Joshua Buchanan
+         * @tparam Floating
+         */
+        template<typename Floating>
+        inline constexpr ScalarKind scalarKindOf =
+            std::numeric_limits<Floating>::digits == 24 &&
+                sizeof(Floating) == 4 ? ScalarKind::Binary32 :
+            std::numeric_limits<Floating>::digits == 53 &&
+                sizeof(Floating) == 8 ? ScalarKind::Binary64 :
+            std::numeric_limits<Floating>::digits == 64 &&
+                sizeof(Floating) == 16 ? ScalarKind::Extended80 :
+            ScalarKind::Unsupported;
+
+        /**
+         * @brief The first bytes of every snapshot file
+         * @details
+         * All numbers are little-endian. The file is laid out as
+         *
+         *     header         (this struct)
+         *     name indices   uint32 per vector, into the name table
+         *     tags           uint8 per vector: bit 0 set for 3 dimensions,
+         *                    bit 1 set for rectangular
+         *     x / r          one Floating per vector
+         *     y / theta      one Floating per vector
+         *     z / phi        one Floating per vector (NaN for 2 dimensions)
+         *     name table     per name: uint32 length, then that many uint32
+         *                    characters (one per wchar_t)
+         *
+         * where every part starts at the first multiple of
+         * snapshotAlignment after the one before it. checksum is the 64 bit
+         * FNV-1a hash of the header (with checksum 0) and the name table;
+         * the columns are not hashed, so that opening a snapshot never has
+         * to read them.
+         * @author Joshua Buchanan
+         */
+        struct SnapshotHeader
+        {
+            char magic[8];
+            std::uint32_t version;
+            std::uint32_t headerSize;
+            ScalarKind scalarKind;
+            std::uint8_t scalarSize;
+            std::uint16_t reserved;
+            std::uint32_t nameCount;
+            std::uint64_t vectorCount;
+            std::uint64_t nameIndexOffset;
+            std::uint64_t tagOffset;
+            std::uint64_t columnOffsets[3];
+            std::uint64_t nameTableOffset;
+            std::uint64_t nameTableSize;
+            std::uint64_t fileSize;
+            std::uint64_t checksum;
+        };
+
+        static_assert(sizeof(SnapshotHeader) == 104);
+
+        /**
+         * @brief Writes VectorBases into a new snapshot file as they come,
+         * without holding the whole collection in memory or knowing how
+         * many there will be
+         * @details
+         * Coordinates are gathered per column in small buffers and written
+         * straight to where their column is in the file. The file has room
+         * for some number of vectors between its parts; when that runs out,
+         * what was written so far moves to a layout with twice the room,
+         * and Close moves it back together so that the columns end where
+         * the last vector does. The name table and the header go in last,
+         * by Close, so a snapshot that was not closed is never mistaken for
+         * a good one.
+         * @note Needs POSIX file I/O and a little-endian CPU; Open fails
+         * otherwise.
+         * @author Joshua Buchanan
+         * @tparam Floating float, double or long double
+         */
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        class SnapshotWriter : public Abstraction::FluidEngineMember
+        {
+        public:
+            using VectorType = Floating;
+
+            /**
+             * @brief How many vectors are buffered before they are written
+             *
+             */
+            static constexpr std::size_t bufferedVectors = 16384;
+
+            /**
+             * @brief How many bytes are copied at a time when the parts of
+             * the file move
+             *
+             */
+            static constexpr std::size_t movedBytes = 1 << 20;
+
+        private:
+
+            int file;
+            bool failed;
+            SnapshotHeader header;
+            std::size_t capacity;
+            std::size_t count;
+            std::size_t written;
+
+            std::unordered_map<Abstraction::NameHandle, std::uint32_t>
+                nameIndices;
+            std::vector<Abstraction::NameHandle> names;
+
+            std::vector<std::uint32_t> bufferedNames;
+            std::vector<std::uint8_t> bufferedTags;
+            // raw bytes: a long double slot has padding that has to be 0
+            std::array<std::vector<unsigned char>, 3> bufferedColumns;
+
+            /**
+             * @brief Adds one vector to the buffers
+             *
+             */
+            void Buffer
+            (
+                const Abstraction::NameHandle& name,
+                const Mathematics::VectorDimensions& dimensions,
+                const Mathematics::VectorFormatting& formatting,
+                const std::array<VectorType, 3>& coordinates
+            ) noexcept;
+
+            /**
+             * @brief Writes the buffers out to their columns
+             *
+             */
+            void Flush() noexcept;
+
+            /**
+             * @brief Moves everything written so far to where it goes when
+             * the file has room for room vectors
+             *
+             */
+            void MoveTo(const std::size_t& room) noexcept;
+
+            /**
+             * @brief Writes size bytes at offset, remembering any failure
+             *
+             */
+            void WriteAt
+            (
+                const void* bytes,
+                const std::size_t& size,
+                const std::uint64_t& offset
+            ) noexcept;
+
+        public:
+
+            SnapshotWriter(const std::wstring&) noexcept;
+            SnapshotWriter() noexcept;
+
+            SnapshotWriter(const SnapshotWriter&) = delete;
+            SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+            /**
+             * @brief Closes the snapshot, if it is open
+             * @author Joshua Buchanan
+             */
+            ~SnapshotWriter() noexcept;
+
+            /**
+             * @brief Starts a new snapshot file
+             * @author Joshua Buchanan
+             * @param path where to write it (overwritten)
+             * @param capacity how many vectors to make room for up front.
+             * Only a hint: more still fit, and a good guess saves moving
+             * the columns (once when they grow past it, once in Close if
+             * fewer were written).
+             * @return Abstraction::Acknowledgement Failure if path cannot be
+             * written, this writer is already open or this platform cannot
+             * write snapshots
+             */
+            Abstraction::Acknowledgement Open
+            (
+                const std::string& path,
+                const std::size_t& capacity = 0
+            ) noexcept;
+
+            /**
+             * @brief Appends a vector
+             * @author Joshua Buchanan
+             * @param vector
+             * @return Abstraction::Acknowledgement Failure (and nothing is
+             * added) if the writer is not open
+             */
+            Abstraction::Acknowledgement Write
+            (
+                const Mathematics::VectorBase<VectorType>& vector
+            ) noexcept;
+
+            /**
+             * @brief Appends every vector of a batch, named after the batch
+             * @author Joshua Buchanan
+             * @param batch
+             * @return Abstraction::Acknowledgement Failure (and nothing is
+             * added) if the writer is not open
+             */
+            Abstraction::Acknowledgement Write
+            (
+                const Mathematics::VectorBatch<VectorType>& batch
+            ) noexcept;
+
+            /**
+             * @brief How many vectors were written so far
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            std::size_t Size() const noexcept;
+
+            /**
+             * @brief Finishes the snapshot: moves the columns together,
+             * writes the name table and the header, and closes the file
+             * @author Joshua Buchanan
+             * @return Abstraction::Acknowledgement Failure if the writer was
+             * not open or anything could not be written
+             */
+            Abstraction::Acknowledgement Close() noexcept;
+        };
+
+        /**
+         * @brief Opens a snapshot by mapping it into memory, and hands out
+         * its columns as spans right into the mapping
+         * @details
+         * Open checks the header, the checksum and every offset against the
+         * file size, interns the names, and goes once over the name indices
+         * and tags to make sure they are in range. The coordinate columns
+         * are never read (or even paged in) until they are used.
+         * @note Needs POSIX mmap and a little-endian CPU; Open fails
+         * otherwise.
+         * @author Joshua Buchanan
+         * @tparam Floating float, double or long double; has to be what the
+         * snapshot was written with
+         */
+        template<FluidEngine::Concepts::UsableInVectorBase Floating>
+        class SnapshotReader : public Abstraction::FluidEngineMember
+        {
+        public:
+            using VectorType = Floating;
+
+        private:
+
+            const unsigned char* mapping;
+            std::size_t mappingSize;
+            SnapshotHeader header;
+            std::vector<Abstraction::NameHandle> names;
+
+            /**
+             * @brief Reads and checks the header and the name table
+             *
+             */
+            Abstraction::Acknowledgement Validate() noexcept;
+
+        public:
+
+            SnapshotReader(const std::wstring&) noexcept;
+            SnapshotReader() noexcept;
+
+            SnapshotReader(const SnapshotReader&) = delete;
+            SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+            /**
+             * @brief Unmaps the snapshot, if one is open
+             * @author Joshua Buchanan
+             */
+            ~SnapshotReader() noexcept;
+
+            /**
+             * @brief Maps a snapshot
+             * @author Joshua Buchanan
+             * @param path
+             * @return Abstraction::Acknowledgement Failure (and nothing is
+             * open) if the file is missing, is not a snapshot of this
+             * version and precision, or is damaged
+             */
+            Abstraction::Acknowledgement Open(const std::string& path)
+            noexcept;
+
+            /**
+             * @brief Unmaps the snapshot; every span handed out is invalid
+             * afterwards
+             * @author Joshua Buchanan
+             */
+            void Close() noexcept;
+
+            /**
+             * @brief How many vectors the snapshot holds (0 if none is open)
+             * @author Joshua Buchanan
+             * @return std::size_t
+             */
+            std::size_t Size() const noexcept;
+
+            /**
+             * @brief One coordinate column (0: x or r, 1: y or theta,
+             * 2: z or phi), aligned to snapshotAlignment
+             * @author Joshua Buchanan
+             * @param index which column
+             * @return std::span<const VectorType>
+             */
+            std::span<const VectorType> GetColumn
+            (
+                const std::size_t& index
+            ) const noexcept;
+
+            /**
+             * @brief Which name every vector has, as an index into
+             * GetNames()
+             * @author Joshua Buchanan
+             * @return std::span<const std::uint32_t>
+             */
+            std::span<const std::uint32_t> GetNameIndices() const noexcept;
+
+            /**
+             * @brief The dimensions and formatting of every vector (bit 0:
+             * 3 dimensions, bit 1: rectangular)
+             * @author Joshua Buchanan
+             * @return std::span<const std::uint8_t>
+             */
+            std::span<const std::uint8_t> GetTags() const noexcept;
+
+            /**
+             * @brief The names in the snapshot, interned
+             * @author Joshua Buchanan
+             * @return const std::vector<Abstraction::NameHandle>&
+             */
+            const std::vector<Abstraction::NameHandle>& GetNames()
+            const noexcept;
+
+            /**
+             * @brief Gets one vector as a VectorBase
+             * @author Joshua Buchanan
+             * @param index which vector (must be less than Size())
+             * @return Mathematics::VectorBase<VectorType>
+             */
+            Mathematics::VectorBase<VectorType> Export
+            (
+                const std::size_t& index
+            ) const noexcept;
+
+            /**
+             * @brief Gets every vector as VectorBases
+             * @author Joshua Buchanan
+             * @return std::vector<Mathematics::VectorBase<VectorType>>
+             */
+            std::vector<Mathematics::VectorBase<VectorType>> ExportAll()
+            const noexcept;
+        };
+
+    } // namespace Serialization
+
+} // namespace FluidEngine
+
+
+#endif
@@ -10,9 +10,30 @@
  */
 
 #include "../Source/Abstraction/FluidEngineMember.h++"
+#include "../Source/Concurrency/JobSystem.h++"
+#include "../Source/Concurrency/TaskGraph.h++"
+#include "../Source/Diagnostics/Instrumentation.h++"
+#include "../Source/Mathematics/BatchKernels.h++"
+#include "../Source/Mathematics/FixedVector.h++"
+#include "../Source/Mathematics/InstructionSets.h++"
+#include "../Source/Mathematics/SpatialGrid.h++"
+#include "../Source/Mathematics/VectorBatch.h++"
+#include "../Source/Serialization/Snapshot.h++"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <random>
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 void TestFluidEngineMember()
 {
@@ -28,6 +49,63 @@ void TestFluidEngineMember()
     std::wcout << foobar << "\n";
 }
 
+void TestFluidEngineMemberIdentity()
+{
+    using namespace FluidEngine::Abstraction;
+
+    FluidEngineMember original(L"Identity");
+    FluidEngineMember copy = original;
+    FluidEngineMember assigned(L"Something Else");
+    const IdentificationNumber assignedNumber =
+        assigned.GetIdentificationNumber();
+    assigned = original;
+    const IdentificationNumber originalNumber =
+        original.GetIdentificationNumber();
+    FluidEngineMember moved = std::move(original);
+
+    const bool namesShared =
+        copy.GetNameHandle() == assigned.GetNameHandle() &&
+        &copy.GetReferenceName() == &assigned.GetReferenceName() &&
+        assigned.GetReferenceName() == L"Identity";
+    const bool numbersBehave =
+        copy.GetIdentificationNumber() != originalNumber &&
+        assigned.GetIdentificationNumber() == assignedNumber &&
+        moved.GetIdentificationNumber() == originalNumber &&
+        original.GetIdentificationNumber() != originalNumber;
+
+    // every thread gets its own numbers
+    std::vector<IdentificationNumber> issued[4];
+    std::vector<std::thread> threads;
+    for (auto& numbers : issued)
+    {
+        threads.emplace_back([&numbers]()
+        {
+            for (int index = 0; index < 5000; ++index)
+            {
+                numbers.push_back
+                (
+                    FluidEngineMember().GetIdentificationNumber()
+                );
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    std::set<IdentificationNumber> unique;
+    for (const auto& numbers : issued)
+    {
+        unique.insert(numbers.begin(), numbers.end());
+    }
+
+    std::wcout << L"FluidEngineMember is " << sizeof(FluidEngineMember)
+               << L" bytes, names shared: " << (namesShared ? L"yes" : L"NO")
+               << L", numbers behave: " << (numbersBehave ? L"yes" : L"NO")
+               << L", unique across threads: "
+               << (unique.size() == 4 * 5000 ? L"yes" : L"NO") << '\n';
+}
+
 void TestFluidEngineShell()
 {
     using namespace FluidEngine::Abstraction;
@@ -49,12 +127,1603 @@ void TestFluidEngineShell()
 
 }
 
+/**
+ * @brief Checks whether two numbers are the same, counting NaN == NaN and
+ * telling -0 and 0 apart
+ * @note No memcmp: long double has padding bytes with garbage in them
+ * @tparam Floating
+ */
+template<typename Floating>
+bool SameValue(const Floating& lhs, const Floating& rhs)
+{
+    return (std::isnan(lhs) && std::isnan(rhs)) ||
+           (lhs == rhs && std::signbit(lhs) == std::signbit(rhs));
+}
+
+/**
+ * @brief Checks whether two columns hold exactly the same values
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+bool SameValues(std::span<const Floating> lhs, std::span<const Floating> rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    for (std::size_t index = 0; index < lhs.size(); ++index)
+    {
+        if (!SameValue(lhs[index], rhs[index]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Checks whether two batches hold exactly the same values
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+bool SameValues
+(
+    const FluidEngine::Mathematics::VectorBatch<Floating>& lhs,
+    const FluidEngine::Mathematics::VectorBatch<Floating>& rhs
+)
+{
+    return SameValues(lhs.GetColumn(0), rhs.GetColumn(0)) &&
+           SameValues(lhs.GetColumn(1), rhs.GetColumn(1)) &&
+           SameValues(lhs.GetColumn(2), rhs.GetColumn(2));
+}
+
+/**
+ * @brief Runs every batch operation on every instruction set this CPU has
+ * and checks them against the scalar path and against VectorBase.
+ *
+ * @tparam Floating
+ * @param dimensions
+ */
+template<typename Floating>
+void TestVectorBatch(FluidEngine::Mathematics::VectorDimensions dimensions)
+{
+    using namespace FluidEngine::Mathematics;
+    using FluidEngine::Abstraction::Acknowledgement;
+
+    // odd size so that every SIMD loop has a tail
+    const std::size_t count = 1003;
+    std::mt19937 generator(1939344);
+    std::uniform_real_distribution<Floating> distribution(-100, 100);
+
+    std::vector<VectorBase<Floating>> vectors;
+    VectorBatch<Floating> batch(L"Batch", dimensions, VectorFormatting::Rct);
+    VectorBatch<Floating> normals(dimensions, VectorFormatting::Rct, count);
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        const Floating x = distribution(generator);
+        const Floating y = distribution(generator);
+        const Floating z = distribution(generator);
+        vectors.push_back
+        (
+            dimensions == VectorDimensions::D3 ?
+            VectorBase<Floating>::Generate3DRVectorWithOutName(x, y, z) :
+            VectorBase<Floating>::Generate2DRVectorWithOutName(x, y)
+        );
+    }
+    batch.Import(vectors);
+    normals = batch.NormalizedForm();
+
+    const bool rejectsPolar = batch.Import
+    (
+        VectorBase<Floating>::Generate2DPVectorWithOutName(1, 0)
+    ) == Acknowledgement::Failure;
+
+    // reference results, one VectorBase at a time
+    bool matchesVectorBase = batch.Size() == count;
+    const auto magnitudes = batch.Magnitude();
+    const auto normalized = batch.NormalizedForm();
+    const auto fastNormalized = batch.FastNormalize();
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        VectorBase<Floating> vector = vectors[index];
+        VectorBase<Floating> exact = vector.NormalizedForm();
+        VectorBase<Floating> fast = vector.FastNormalize();
+        VectorBase<Floating> exported = batch.Export(index);
+
+        matchesVectorBase = matchesVectorBase &&
+            SameValue(vector.Magnitude(), magnitudes[index]);
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            matchesVectorBase = matchesVectorBase && SameValue
+            (
+                exported.GetCoordinates()[axis],
+                vector.GetCoordinates()[axis]
+            );
+        }
+        for (std::size_t axis = 0; axis < 2; ++axis)
+        {
+            matchesVectorBase = matchesVectorBase &&
+                SameValue
+                (
+                    exact.GetCoordinates()[axis],
+                    normalized.GetColumn(axis)[index]
+                ) &&
+                SameValue
+                (
+                    fast.GetCoordinates()[axis],
+                    fastNormalized.GetColumn(axis)[index]
+                );
+        }
+    }
+
+    ForceInstructionSet(InstructionSet::Scalar);
+    const auto scalarMagnitudes = batch.Magnitude();
+    const auto scalarNormalized = batch.NormalizedForm();
+    const auto scalarFast = batch.FastNormalize();
+    const VectorBatch<Floating> scalarSum = batch + normals;
+    const VectorBatch<Floating> scalarDifference = batch - normals;
+    const VectorBatch<Floating> scalarProduct = batch * normals;
+    const VectorBatch<Floating> scalarQuotient = batch / normals;
+    const VectorBatch<Floating> scalarReflection = batch.Reflection(normals);
+
+    std::wcout << L"VectorBatch<" << sizeof(Floating) << L" byte> "
+               << (dimensions == VectorDimensions::D3 ? L"3D" : L"2D")
+               << L": matches VectorBase: "
+               << (matchesVectorBase ? L"yes" : L"NO")
+               << L", rejects mismatched tags: "
+               << (rejectsPolar ? L"yes" : L"NO") << '\n';
+
+    for (InstructionSet instructionSet :
+        {InstructionSet::SSE2, InstructionSet::AVX2})
+    {
+        if (ForceInstructionSet(instructionSet) == Acknowledgement::Failure)
+        {
+            continue;
+        }
+
+        const bool identical =
+            SameValues<Floating>(batch.Magnitude(), scalarMagnitudes) &&
+            SameValues(batch.NormalizedForm(), scalarNormalized) &&
+            SameValues(batch.FastNormalize(), scalarFast) &&
+            SameValues<Floating>(batch + normals, scalarSum) &&
+            SameValues<Floating>(batch - normals, scalarDifference) &&
+            SameValues<Floating>(batch * normals, scalarProduct) &&
+            SameValues<Floating>(batch / normals, scalarQuotient) &&
+            SameValues<Floating>
+            (
+                batch.Reflection(normals),
+                scalarReflection
+            );
+
+        std::wcout << L"    "
+                   << (instructionSet == InstructionSet::AVX2 ?
+                       L"AVX2" : L"SSE2")
+                   << L" identical to scalar: "
+                   << (identical ? L"yes" : L"NO") << '\n';
+    }
+
+    ForceInstructionSet(DetectInstructionSet());
+}
+
+/**
+ * @brief Combines 3 dimensional batches with 2 dimensional ones, and polar
+ * batches with rectangular ones, on every instruction set and through both
+ * the kernel and the fused path: the missing z has to count as NaN and never
+ * be read, and mixed formattings combine the raw coordinates
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+void TestMixedVectorBatch()
+{
+    using namespace FluidEngine::Mathematics;
+    using FluidEngine::Abstraction::Acknowledgement;
+
+    const std::size_t count = 1003;
+    std::mt19937 generator(1939344);
+    std::uniform_real_distribution<Floating> distribution(-100, 100);
+
+    VectorBatch<Floating> spatial
+    (
+        VectorDimensions::D3,
+        VectorFormatting::Rct,
+        count
+    );
+    VectorBatch<Floating> flat
+    (
+        VectorDimensions::D2,
+        VectorFormatting::Rct,
+        count
+    );
+    // spatial without its z
+    VectorBatch<Floating> flattened
+    (
+        VectorDimensions::D2,
+        VectorFormatting::Rct,
+        count
+    );
+    // spatial's numbers, but polar
+    VectorBatch<Floating> polar
+    (
+        VectorDimensions::D3,
+        VectorFormatting::Plr,
+        count
+    );
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            spatial.GetColumn(axis)[index] = distribution(generator);
+            polar.GetColumn(axis)[index] = spatial.GetColumn(axis)[index];
+        }
+        for (std::size_t axis = 0; axis < 2; ++axis)
+        {
+            flat.GetColumn(axis)[index] = distribution(generator);
+            flattened.GetColumn(axis)[index] =
+                spatial.GetColumn(axis)[index];
+        }
+    }
+
+    // x and y as if both were 2 dimensional, z all NaN
+    const auto nanZ = [&]
+    (
+        const VectorBatch<Floating>& result,
+        const VectorBatch<Floating>& reference
+    )
+    {
+        bool matches = result.GetDimensions() == VectorDimensions::D3 &&
+            result.Size() == count &&
+            SameValues(result.GetColumn(0), reference.GetColumn(0)) &&
+            SameValues(result.GetColumn(1), reference.GetColumn(1));
+        for (const Floating& z : result.GetColumn(2))
+        {
+            matches = matches && std::isnan(z);
+        }
+        return matches;
+    };
+
+    bool mixes = true;
+    for (InstructionSet instructionSet :
+        {InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2})
+    {
+        if (ForceInstructionSet(instructionSet) == Acknowledgement::Failure)
+        {
+            continue;
+        }
+
+        const VectorBatch<Floating> sum = spatial + flat;
+        const VectorBatch<Floating> difference = spatial - flat;
+        const VectorBatch<Floating> product = spatial * flat;
+        const VectorBatch<Floating> quotient = spatial / flat;
+        const VectorBatch<Floating> flatSum = flat + spatial;
+        const VectorBatch<Floating> flatReference = flat + flattened;
+        const VectorBatch<Floating> unreflected = spatial.Reflection(flat);
+        const VectorBatch<Floating> reflected = flat.Reflection(spatial);
+        const VectorBatch<Floating> reflectedReference =
+            flat.Reflection(flattened);
+        // * 1 keeps the numbers but takes the fused loop instead
+        const VectorBatch<Floating> fusedSum = spatial + flat * Floating(1);
+        const VectorBatch<Floating> fusedQuotient =
+            spatial / (flat * Floating(1));
+        const VectorBatch<Floating> polarSum = polar + spatial;
+        const VectorBatch<Floating> fusedPolarSum =
+            polar + spatial * Floating(1);
+        const VectorBatch<Floating> unreflectedPolar =
+            polar.Reflection(spatial);
+
+        mixes = mixes &&
+            nanZ(sum, VectorBatch<Floating>(flattened + flat)) &&
+            nanZ(difference, VectorBatch<Floating>(flattened - flat)) &&
+            nanZ(product, VectorBatch<Floating>(flattened * flat)) &&
+            nanZ(quotient, VectorBatch<Floating>(flattened / flat)) &&
+            flatSum.GetDimensions() == VectorDimensions::D2 &&
+            SameValues(flatSum, flatReference) &&
+            SameValues(unreflected, spatial) &&
+            reflected.GetDimensions() == VectorDimensions::D2 &&
+            SameValues(reflected, reflectedReference) &&
+            nanZ(fusedSum, VectorBatch<Floating>(flattened + flat)) &&
+            nanZ(fusedQuotient, VectorBatch<Floating>(flattened / flat)) &&
+            polarSum.GetFormatting() == VectorFormatting::Plr &&
+            SameValues(polarSum, VectorBatch<Floating>(spatial + spatial)) &&
+            SameValues(fusedPolarSum, polarSum) &&
+            SameValues(unreflectedPolar, polar);
+    }
+
+    ForceInstructionSet(DetectInstructionSet());
+
+    std::wcout << L"VectorBatch<" << sizeof(Floating) << L" byte> 3D with "
+               << L"2D and polar with rectangular, kernel and fused: "
+               << (mixes ? L"yes" : L"NO") << '\n';
+}
+
+void TestVectorBatches()
+{
+    using FluidEngine::Mathematics::VectorDimensions;
+
+    TestVectorBatch<float>(VectorDimensions::D2);
+    TestVectorBatch<float>(VectorDimensions::D3);
+    TestVectorBatch<double>(VectorDimensions::D2);
+    TestVectorBatch<double>(VectorDimensions::D3);
+    TestVectorBatch<long double>(VectorDimensions::D3);
+    TestMixedVectorBatch<float>();
+    TestMixedVectorBatch<double>();
+    TestMixedVectorBatch<long double>();
+}
+
+/**
+ * @brief Checks lazily evaluated expressions against doing one operation at a
+ * time, for single VectorBases and for batches
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+void TestVectorExpression()
+{
+    using namespace FluidEngine::Mathematics;
+
+    const std::size_t count = 1003;
+    const Floating dt = 0.01;
+    std::mt19937 generator(1939344);
+    std::uniform_real_distribution<Floating> distribution(-100, 100);
+    const auto random = [&]()
+    {
+        return VectorBase<Floating>::Generate3DRVectorWithOutName
+        (
+            distribution(generator),
+            distribution(generator),
+            distribution(generator)
+        );
+    };
+
+    // single vectors, against FixedVector's eager operators
+    const VectorBase<Floating> a =
+        VectorBase<Floating>::Generate3DRVectorWithName(L"a", 1.5, -2.25, 7);
+    const VectorBase<Floating> b = random();
+    const VectorBase<Floating> c = random();
+    const VectorBase<Floating> d = random();
+    const VectorBase<Floating> n = random().NormalizedForm();
+    const RectangularVector3<Floating> fixedA(a), fixedB(b), fixedC(c);
+    const RectangularVector3<Floating> fixedD(d), fixedN(n);
+
+    const VectorBase<Floating> lazy = a + b * c - d.Reflection(n);
+    const RectangularVector3<Floating> eager =
+        fixedA + fixedB * fixedC - fixedD.Reflection(fixedN);
+    const VectorBase<Floating> scaled = a + b * dt - 2 * c / 3;
+
+    bool matchesEager = lazy.GetNameHandle() == a.GetNameHandle() &&
+        lazy.GetDimensions() == VectorDimensions::D3;
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        const Floating expected = a.GetCoordinates()[axis] +
+            b.GetCoordinates()[axis] * dt -
+            2 * c.GetCoordinates()[axis] / 3;
+        matchesEager = matchesEager &&
+            SameValue(lazy.GetCoordinates()[axis], eager.coordinates[axis]) &&
+            SameValue(scaled.GetCoordinates()[axis], expected);
+    }
+
+    const VectorBase<Floating> flat =
+        VectorBase<Floating>::Generate2DRVectorWithOutName(3, -4);
+    const VectorBase<Floating> up =
+        VectorBase<Floating>::Generate2DRVectorWithOutName(0, 1);
+    const VectorBase<Floating> flatReflected = flat.Reflection(up) * 2;
+    matchesEager = matchesEager &&
+        flatReflected.GetDimensions() == VectorDimensions::D2 &&
+        flatReflected.GetCoordinates()[0] == 6 &&
+        flatReflected.GetCoordinates()[1] == 8 &&
+        std::isnan(flatReflected.GetCoordinates()[2]);
+
+    // batches, against one batch operation at a time
+    VectorBatch<Floating> positions(L"Positions", VectorDimensions::D3,
+        VectorFormatting::Rct);
+    VectorBatch<Floating> velocities(VectorDimensions::D3,
+        VectorFormatting::Rct);
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        positions.Import(random());
+        velocities.Import(random());
+    }
+    const VectorBatch<Floating> normals = positions.NormalizedForm();
+    const VectorBase<Floating> gravity =
+        VectorBase<Floating>::Generate3DRVectorWithOutName(0, -9.81, 0);
+
+    const VectorBatch<Floating> fused =
+        positions + velocities * positions - velocities.Reflection(normals);
+    VectorBatch<Floating> stepped = velocities * positions;
+    stepped = positions + stepped;
+    const VectorBatch<Floating> reflected = velocities.Reflection(normals);
+    stepped = stepped - reflected;
+
+    bool matchesSteps = SameValues(fused, stepped) &&
+        fused.GetNameHandle() == positions.GetNameHandle() &&
+        fused.Size() == count;
+
+    // an integrator step, in place, with a VectorBase applied to every vector
+    VectorBatch<Floating> integrated = positions;
+    integrated = integrated + (velocities + gravity * dt) * dt;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        const VectorBase<Floating> position = positions.Export(index);
+        const VectorBase<Floating> velocity = velocities.Export(index);
+        const VectorBase<Floating> expected =
+            position + (velocity + gravity * dt) * dt;
+        const VectorBase<Floating> actual = integrated.Export(index);
+
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            matchesSteps = matchesSteps && SameValue
+            (
+                actual.GetCoordinates()[axis],
+                expected.GetCoordinates()[axis]
+            );
+        }
+    }
+    matchesSteps = matchesSteps &&
+        integrated.GetNameHandle() == positions.GetNameHandle();
+
+    std::wcout << L"Expressions<" << sizeof(Floating) << L" byte>"
+               << L": VectorBase matches eager: "
+               << (matchesEager ? L"yes" : L"NO")
+               << L", VectorBatch matches one step at a time: "
+               << (matchesSteps ? L"yes" : L"NO") << '\n';
+}
+
+void TestVectorExpressions()
+{
+    TestVectorExpression<float>();
+    TestVectorExpression<double>();
+    TestVectorExpression<long double>();
+}
+
+void TestJobSystem()
+{
+    using namespace FluidEngine::Mathematics;
+    using namespace FluidEngine::Concurrency;
+    using FluidEngine::Abstraction::Acknowledgement;
+
+    // the deque on its own: LIFO for the owner, everything taken only once
+    WorkStealingDeque<std::size_t> deque(4);
+    for (std::size_t item = 0; item < 10; ++item)
+    {
+        deque.Push(item);
+    }
+    bool dequeBehaves = deque.Size() == 10;
+    std::size_t item = 0;
+    for (std::size_t expected = 10; expected-- > 5;)
+    {
+        dequeBehaves = dequeBehaves && deque.Pop(item) && item == expected;
+    }
+    dequeBehaves = dequeBehaves && deque.Steal(item) && item == 0;
+    while (deque.Pop(item))
+    {
+        /*leftovers of the single threaded part*/
+    }
+
+    const std::size_t stolenCount = 100000;
+    std::vector<std::atomic<std::size_t>> taken(stolenCount);
+    std::atomic<bool> pushing(true);
+    std::vector<std::thread> thieves;
+    for (int thief = 0; thief < 3; ++thief)
+    {
+        thieves.emplace_back([&]()
+        {
+            std::size_t stolen = 0;
+            while (pushing.load() || deque.Size() != 0)
+            {
+                if (deque.Steal(stolen))
+                {
+                    ++taken[stolen];
+                }
+            }
+        });
+    }
+    for (std::size_t stolen = 0; stolen < stolenCount; ++stolen)
+    {
+        deque.Push(stolen);
+        if (stolen % 3 == 0 && deque.Pop(item))
+        {
+            ++taken[item];
+        }
+    }
+    while (deque.Pop(item))
+    {
+        ++taken[item];
+    }
+    pushing.store(false);
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+    for (const auto& times : taken)
+    {
+        dequeBehaves = dequeBehaves && times.load() == 1;
+    }
+
+    // ParallelFor and ParallelReduce, against doing it serially
+    const std::size_t count = 10007;
+    std::mt19937 generator(1939344);
+    std::uniform_real_distribution<double> distribution(-100, 100);
+    std::vector<VectorBase<double>> vectors;
+    VectorBatch<float> batch(VectorDimensions::D3, VectorFormatting::Rct);
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        vectors.push_back
+        (
+            VectorBase<double>::Generate3DRVectorWithOutName
+            (
+                distribution(generator),
+                distribution(generator),
+                distribution(generator)
+            )
+        );
+        batch.Import(vectors.back().ConvertLowPrecision());
+    }
+    std::vector<VectorBase<double>> serial = vectors;
+    for (auto& vector : serial)
+    {
+        vector = vector.FastNormalize();
+    }
+    float serialSum = 0;
+    for (const auto& vector : vectors)
+    {
+        serialSum += vector.ConvertLowPrecision().GetCoordinates()[0];
+    }
+
+    const std::size_t grain = 64;
+    const auto normalizeChunk = [](VectorBatch<float>& batch, Range chunk)
+    {
+        const std::size_t length = chunk.end - chunk.begin;
+        BatchKernels::FastNormalize<float>
+        (
+            {
+                batch.GetColumn(0).subspan(chunk.begin, length),
+                batch.GetColumn(1).subspan(chunk.begin, length),
+                batch.GetColumn(2).subspan(chunk.begin, length)
+            },
+            {
+                batch.GetColumn(0).subspan(chunk.begin, length),
+                batch.GetColumn(1).subspan(chunk.begin, length),
+                batch.GetColumn(2).subspan(chunk.begin, length)
+            }
+        );
+    };
+    VectorBatch<float> serialBatch = batch;
+    for (std::size_t begin = 0; begin < count; begin += grain)
+    {
+        normalizeChunk(serialBatch, {begin, std::min(count, begin + grain)});
+    }
+
+    bool matchesSerial = true;
+    bool visitedOnce = true;
+    bool sumsMatch = true;
+    bool nestedWorks = true;
+    for (std::size_t threadCount : {1, 2, 4, 8})
+    {
+        JobSystem system(L"Test Jobs", threadCount);
+        matchesSerial = matchesSerial && system.ThreadCount() == threadCount;
+
+        std::vector<VectorBase<double>> parallel = vectors;
+        std::vector<std::atomic<std::size_t>> visits(count);
+        system.ParallelFor({0, count}, grain, [&](const Range& chunk)
+        {
+            for (std::size_t index = chunk.begin; index < chunk.end; ++index)
+            {
+                parallel[index] = parallel[index].FastNormalize();
+                ++visits[index];
+            }
+        });
+        VectorBatch<float> parallelBatch = batch;
+        system.ParallelFor({0, count}, grain, [&](const Range& chunk)
+        {
+            normalizeChunk(parallelBatch, chunk);
+        });
+
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            visitedOnce = visitedOnce && visits[index].load() == 1;
+            for (std::size_t axis = 0; axis < 3; ++axis)
+            {
+                matchesSerial = matchesSerial && SameValue
+                (
+                    parallel[index].GetCoordinates()[axis],
+                    serial[index].GetCoordinates()[axis]
+                );
+            }
+        }
+        matchesSerial = matchesSerial && SameValues(parallelBatch, serialBatch);
+
+        // one element per chunk: the sum is the serial one, bit for bit
+        const float sum = system.ParallelReduce
+        (
+            Range{0, count},
+            1,
+            0.0f,
+            [&](const Range& chunk)
+            {
+                return vectors[chunk.begin].ConvertLowPrecision()
+                    .GetCoordinates()[0];
+            },
+            [](const float& lhs, const float& rhs)
+            {
+                return lhs + rhs;
+            }
+        );
+        sumsMatch = sumsMatch && SameValue(sum, serialSum);
+
+        // bools, one chunk false: a partial lost to a neighbour's write
+        // would leave it true
+        const bool allTrue = system.ParallelReduce
+        (
+            Range{0, count},
+            1,
+            true,
+            [](const Range& chunk)
+            {
+                return chunk.begin != 4321;
+            },
+            [](const bool& lhs, const bool& rhs)
+            {
+                return lhs && rhs;
+            }
+        );
+        sumsMatch = sumsMatch && !allTrue;
+
+        // ParallelFor inside ParallelFor
+        std::vector<std::atomic<std::size_t>> cells(64 * 64);
+        system.ParallelFor({0, 64}, 1, [&](const Range& row)
+        {
+            system.ParallelFor({0, 64}, 8, [&](const Range& columns)
+            {
+                for (std::size_t column = columns.begin; column < columns.end;
+                    ++column)
+                {
+                    ++cells[row.begin * 64 + column];
+                }
+            });
+        });
+        for (const auto& cell : cells)
+        {
+            nestedWorks = nestedWorks && cell.load() == 1;
+        }
+    }
+
+    // a diamond, a -> (b, c) -> d, with room for b and c to race
+    JobSystem system(L"Graph Jobs", 4);
+    TaskGraph graph(L"Diamond");
+    std::atomic<std::size_t> clock(0);
+    std::size_t stamps[4] = {};
+    const TaskGraph::TaskHandle a = graph.Add([&]() { stamps[0] = ++clock; });
+    const TaskGraph::TaskHandle b = graph.Add([&]() { stamps[1] = ++clock; });
+    const TaskGraph::TaskHandle c = graph.Add([&]() { stamps[2] = ++clock; });
+    const TaskGraph::TaskHandle d = graph.Add([&]() { stamps[3] = ++clock; });
+    bool graphWorks =
+        graph.Precede(a, b) == Acknowledgement::Success &&
+        graph.Precede(a, c) == Acknowledgement::Success &&
+        graph.Precede(b, d) == Acknowledgement::Success &&
+        graph.Precede(c, d) == Acknowledgement::Success &&
+        graph.Precede(a, a) == Acknowledgement::Failure &&
+        graph.Precede(a, 4) == Acknowledgement::Failure;
+    for (int run = 0; run < 100; ++run)
+    {
+        graphWorks = graphWorks &&
+            graph.Run(system) == Acknowledgement::Success &&
+            stamps[0] < stamps[1] && stamps[0] < stamps[2] &&
+            stamps[1] < stamps[3] && stamps[2] < stamps[3];
+    }
+    graphWorks = graphWorks && clock.load() == 400;
+
+    // d -> a closes a cycle, and then nothing may run
+    graphWorks = graphWorks &&
+        graph.Precede(d, a) == Acknowledgement::Success &&
+        graph.Run(system) == Acknowledgement::Failure &&
+        clock.load() == 400;
+
+    std::wcout << L"JobSystem (" << JobSystem::DefaultThreadCount()
+               << L" cores): deque behaves: "
+               << (dequeBehaves ? L"yes" : L"NO")
+               << L", ParallelFor matches serial: "
+               << (matchesSerial ? L"yes" : L"NO")
+               << L", every index once: " << (visitedOnce ? L"yes" : L"NO")
+               << L", ParallelReduce deterministic: "
+               << (sumsMatch ? L"yes" : L"NO")
+               << L", nested: " << (nestedWorks ? L"yes" : L"NO")
+               << L", task graph: " << (graphWorks ? L"yes" : L"NO") << '\n';
+}
+
+void TestInstrumentation()
+{
+    using namespace FluidEngine::Abstraction;
+    using namespace FluidEngine::Concurrency;
+    using namespace FluidEngine::Diagnostics;
+    using namespace FluidEngine::Mathematics;
+
+    TraceWriter writer(L"Test Trace");
+    const std::string tracePath = "InstrumentationTest.json";
+
+    if constexpr (!instrumentationEnabled)
+    {
+        // the macros are no-ops, so nothing is ever counted
+        const std::uint64_t constructed =
+            CounterTotal(Counter::MembersConstructed);
+        {
+            FluidEngineMember counted(L"Counted");
+        }
+        std::wcout << L"Instrumentation is not built in, TraceWriter "
+                   << L"refuses to start: "
+                   << (writer.Start(tracePath) == Acknowledgement::Failure ?
+                       L"yes" : L"NO")
+                   << L", nothing counted: "
+                   << (CounterTotal(Counter::MembersConstructed) ==
+                       constructed ? L"yes" : L"NO") << '\n';
+        return;
+    }
+
+    // counters, by how much they move
+    const auto delta = [](const Counter& counter, const std::uint64_t& from)
+    {
+        return CounterTotal(counter) - from;
+    };
+    const std::uint64_t constructed = CounterTotal(Counter::MembersConstructed);
+    const std::uint64_t assigned = CounterTotal(Counter::MembersAssigned);
+    {
+        FluidEngineMember first(L"Counted");
+        FluidEngineMember second;
+        FluidEngineMember copy(first);
+        FluidEngineMember moved(std::move(second));
+        copy = moved;
+    }
+    bool countersCount =
+        delta(Counter::MembersConstructed, constructed) == 4 &&
+        delta(Counter::MembersAssigned, assigned) == 1;
+
+    const VectorBase<double> vector =
+        VectorBase<double>::Generate3DRVectorWithOutName(3, 4, 12);
+    VectorBatch<float> batch(VectorDimensions::D3, VectorFormatting::Rct);
+    for (int index = 0; index < 100; ++index)
+    {
+        batch.Import(vector.ConvertLowPrecision());
+    }
+    const std::uint64_t normalized = CounterTotal(Counter::VectorsNormalized);
+    const std::uint64_t fast = CounterTotal(Counter::FastPathHits);
+    const std::uint64_t exact = CounterTotal(Counter::ExactPathHits);
+    const VectorBase<double> exactly = vector.NormalizedForm();
+    const VectorBase<double> quickly = vector.FastNormalize();
+    const VectorBatch<float> batchNormalized = batch.FastNormalize();
+    countersCount = countersCount &&
+        std::abs(exactly.GetCoordinates()[2] - 12.0 / 13) < 1e-12 &&
+        std::abs(quickly.GetCoordinates()[2] - 12.0 / 13) < 2e-3 &&
+        batchNormalized.Size() == 100 &&
+        delta(Counter::VectorsNormalized, normalized) == 102 &&
+        delta(Counter::FastPathHits, fast) == 101 &&
+        delta(Counter::ExactPathHits, exact) == 1;
+
+    // a trace of some jobs
+    TraceWriter other(L"Second Trace");
+    bool traceWorks =
+        writer.Start(tracePath, std::chrono::milliseconds(1)) ==
+            Acknowledgement::Success &&
+        other.Start("SecondTrace.json") == Acknowledgement::Failure;
+    {
+        JobSystem system(L"Traced Jobs", 4);
+        std::atomic<std::size_t> sum(0);
+        system.ParallelFor({0, 10000}, 100, [&](const Range& chunk)
+        {
+            sum += chunk.end - chunk.begin;
+        });
+        TaskGraph graph(L"Traced Graph");
+        const TaskGraph::TaskHandle before = graph.Add([&]() { ++sum; });
+        const TaskGraph::TaskHandle after = graph.Add([&]() { ++sum; });
+        graph.Precede(before, after);
+        traceWorks = traceWorks &&
+            graph.Run(system) == Acknowledgement::Success &&
+            sum.load() == 10002;
+    }
+    traceWorks = traceWorks &&
+        writer.Stop() == Acknowledgement::Success &&
+        writer.Stop() == Acknowledgement::Failure;
+
+    std::ifstream traceFile(tracePath);
+    const std::string trace
+    (
+        (std::istreambuf_iterator<char>(traceFile)),
+        std::istreambuf_iterator<char>()
+    );
+    traceFile.close();
+    std::remove(tracePath.c_str());
+
+    const auto has = [&trace](const std::string& text)
+    {
+        return trace.find(text) != std::string::npos;
+    };
+    traceWorks = traceWorks &&
+        trace.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0 &&
+        trace.size() > 4 && trace.substr(trace.size() - 4) == "\n]}\n" &&
+        has("\"name\":\"JobSystem::ParallelFor\",\"ph\":\"X\"") &&
+        has("\"name\":\"ParallelFor job\",\"ph\":\"X\"") &&
+        has("\"name\":\"TaskGraph::Run\",\"ph\":\"X\"") &&
+        has("\"name\":\"TaskGraph task\",\"ph\":\"X\"") &&
+        has("\"name\":\"JobsRun\",\"ph\":\"C\"") &&
+        has("\"name\":\"MembersConstructed\",\"ph\":\"C\"") &&
+        std::count(trace.begin(), trace.end(), '{') ==
+            std::count(trace.begin(), trace.end(), '}') &&
+        std::count(trace.begin(), trace.end(), '[') ==
+            std::count(trace.begin(), trace.end(), ']');
+
+    std::wcout << L"Instrumentation: counters count: "
+               << (countersCount ? L"yes" : L"NO")
+               << L", Chrome trace written: " << (traceWorks ? L"yes" : L"NO")
+               << L" (" << trace.size() << L" bytes)\n";
+}
+
+/**
+ * @brief Checks SpatialGrid queries against looking at every particle, with
+ * VectorBase's operator- and Magnitude
+ *
+ * @tparam Floating
+ * @param dimensions
+ */
+template<typename Floating>
+void TestSpatialGrid(FluidEngine::Mathematics::VectorDimensions dimensions)
+{
+    using namespace FluidEngine::Mathematics;
+    using FluidEngine::Abstraction::Acknowledgement;
+    using FluidEngine::Concurrency::JobSystem;
+
+    const std::size_t count = 3000;
+    const bool threeDimensional = dimensions == VectorDimensions::D3;
+    std::mt19937 generator(1939344);
+    std::uniform_real_distribution<Floating> distribution(0, 10);
+    std::uniform_real_distribution<Floating> jitter(-0.3, 0.3);
+
+    VectorBatch<Floating> positions(dimensions, VectorFormatting::Rct);
+    const auto position = [&](const Floating& x, const Floating& y,
+        const Floating& z)
+    {
+        return threeDimensional ?
+            VectorBase<Floating>::Generate3DRVectorWithOutName(x, y, z) :
+            VectorBase<Floating>::Generate2DRVectorWithOutName(x, y);
+    };
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        // every tenth one lands on an earlier one, for ties
+        positions.Import
+        (
+            index % 10 == 9 ?
+            positions.Export(index / 2) :
+            position
+            (
+                distribution(generator),
+                distribution(generator),
+                distribution(generator)
+            )
+        );
+    }
+
+    const auto bruteNeighbors = [&](const VectorBase<Floating>& point,
+        const Floating& radius)
+    {
+        std::vector<std::size_t> found;
+        for (std::size_t index = 0; index < positions.Size(); ++index)
+        {
+            const VectorBase<Floating> difference =
+                positions.Export(index) - point;
+            if (difference.Magnitude() <= radius * radius)
+            {
+                found.push_back(index);
+            }
+        }
+        return found;
+    };
+    const auto bruteNearest = [&](const VectorBase<Floating>& point,
+        const std::size_t& wanted)
+    {
+        std::vector<std::pair<Floating, std::size_t>> all;
+        for (std::size_t index = 0; index < positions.Size(); ++index)
+        {
+            const VectorBase<Floating> difference =
+                positions.Export(index) - point;
+            all.push_back({difference.Magnitude(), index});
+        }
+        std::sort(all.begin(), all.end());
+        std::vector<std::size_t> found;
+        for (std::size_t index = 0; index < std::min(wanted, all.size());
+            ++index)
+        {
+            found.push_back(all[index].second);
+        }
+        return found;
+    };
+
+    // query points inside, on particles, and well outside the grid
+    std::uniform_real_distribution<Floating> around(-5, 15);
+    std::vector<VectorBase<Floating>> points;
+    for (std::size_t index = 0; index < 60; ++index)
+    {
+        points.push_back
+        (
+            index % 3 == 0 ?
+            positions.Export(index * 7) :
+            position(around(generator), around(generator), around(generator))
+        );
+    }
+
+    const auto matches = [&](const SpatialGrid<Floating>& grid)
+    {
+        std::vector<std::size_t> found;
+        for (const VectorBase<Floating>& point : points)
+        {
+            for (const Floating& radius : {Floating(0.4), Floating(2.5)})
+            {
+                grid.FindNeighbors(point.GetCoordinates(), radius, found);
+                std::sort(found.begin(), found.end());
+                if (found != bruteNeighbors(point, radius))
+                {
+                    return false;
+                }
+            }
+            for
+            (
+                const std::size_t wanted :
+                    {std::size_t(1), std::size_t(16), std::size_t(100)}
+            )
+            {
+                grid.FindNearest(point.GetCoordinates(), wanted, found);
+                if (found != bruteNearest(point, wanted))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    SpatialGrid<Floating> grid(L"Test Grid", dimensions, 0.5);
+    bool correct = grid.Build(positions) == Acknowledgement::Success &&
+        grid.Size() == count &&
+        grid.GetCellSize() >= Floating(0.5) &&
+        matches(grid);
+
+    // the same grid, whoever builds it
+    JobSystem system(L"Grid Builders", 4);
+    SpatialGrid<Floating> parallel(L"Parallel Grid", dimensions, 0.5);
+    bool sameInParallel =
+        parallel.Build(positions, system) == Acknowledgement::Success &&
+        parallel.CellCount() == grid.CellCount();
+    std::vector<std::size_t> serialFound;
+    std::vector<std::size_t> parallelFound;
+    for (const VectorBase<Floating>& point : points)
+    {
+        grid.FindNeighbors(point.GetCoordinates(), 1.5, serialFound);
+        parallel.FindNeighbors(point.GetCoordinates(), 1.5, parallelFound);
+        sameInParallel = sameInParallel && serialFound == parallelFound;
+    }
+
+    // moving a few, within the grid and then out of it
+    std::vector<std::size_t> moved;
+    for (std::size_t index = 0; index < count; index += 37)
+    {
+        moved.push_back(index);
+        for (std::size_t axis = 0; axis < (threeDimensional ? 3u : 2u);
+            ++axis)
+        {
+            Floating& coordinate = positions.GetColumn(axis)[index];
+            coordinate = std::clamp<Floating>
+            (
+                coordinate + jitter(generator),
+                0,
+                9.5
+            );
+        }
+    }
+    // neighbors come out in slot order, so this checks the layout too
+    SpatialGrid<Floating> rebuilt(L"Rebuilt Grid", dimensions, 0.5);
+    const auto sameAsBuilt = [&]()
+    {
+        bool same = rebuilt.Build(positions) == Acknowledgement::Success &&
+            rebuilt.CellCount() == grid.CellCount();
+        for (const VectorBase<Floating>& point : points)
+        {
+            grid.FindNeighbors(point.GetCoordinates(), 1.5, serialFound);
+            rebuilt.FindNeighbors(point.GetCoordinates(), 1.5, parallelFound);
+            same = same && serialFound == parallelFound;
+        }
+        return same;
+    };
+    // listed twice, which must not confuse it
+    moved.push_back(moved[2]);
+    bool updates =
+        grid.Update(positions, moved) == Acknowledgement::Success &&
+        matches(grid) &&
+        sameAsBuilt();
+
+    // so many that the whole counting sort is redone
+    std::vector<std::size_t> many;
+    for (std::size_t index = 0; index < count; index += 3)
+    {
+        many.push_back(index);
+        positions.GetColumn(0)[index] = std::clamp<Floating>
+        (
+            positions.GetColumn(0)[index] + jitter(generator),
+            0,
+            9.5
+        );
+    }
+    updates = updates &&
+        grid.Update(positions, many) == Acknowledgement::Success &&
+        matches(grid) &&
+        sameAsBuilt();
+
+    positions.GetColumn(0)[moved[1]] = 50;
+    updates = updates &&
+        grid.Update(positions, moved) == Acknowledgement::Success &&
+        matches(grid);
+    const std::size_t outOfRange[] = {count};
+    updates = updates &&
+        grid.Update(positions, outOfRange) == Acknowledgement::Failure;
+
+    // far apart clusters would make too many cells of the size asked for
+    VectorBatch<Floating> sparse(dimensions, VectorFormatting::Rct);
+    for (std::size_t index = 0; index < 100; ++index)
+    {
+        const Floating offset = index % 2 == 0 ? 0 : 1e5;
+        sparse.Import
+        (
+            position
+            (
+                offset + distribution(generator),
+                distribution(generator),
+                offset + distribution(generator)
+            )
+        );
+    }
+    SpatialGrid<Floating> sparseGrid(dimensions, 0.01);
+    std::vector<std::size_t> found;
+    sparseGrid.FindNearest({0, 0, 0}, 5, found);
+    bool refuses = found.empty() &&
+        sparseGrid.Build(sparse) == Acknowledgement::Success &&
+        sparseGrid.CellCount() <=
+            SpatialGrid<Floating>::cellsPerParticle * 100 + 64;
+    sparseGrid.FindNearest(sparse.Export(1).GetCoordinates(), 100, found);
+    refuses = refuses && found.size() == 100 && found[0] == 1;
+
+    // and what it has to refuse
+    const VectorBatch<Floating> polar
+    (
+        dimensions,
+        VectorFormatting::Plr,
+        10
+    );
+    sparse.GetColumn(1)[3] = std::numeric_limits<Floating>::quiet_NaN();
+    SpatialGrid<Floating> zeroSized(dimensions, 0);
+    // the extent of these overflows, which used to grow the cells forever
+    VectorBatch<Floating> huge(dimensions, VectorFormatting::Rct);
+    huge.Import(position(-std::numeric_limits<Floating>::max(), 0, 0));
+    huge.Import(position(std::numeric_limits<Floating>::max(), 0, 0));
+    refuses = refuses &&
+        sparseGrid.Build(polar) == Acknowledgement::Failure &&
+        sparseGrid.Size() == 0 &&
+        sparseGrid.Build(sparse) == Acknowledgement::Failure &&
+        sparseGrid.Size() == 0 &&
+        zeroSized.Build(positions) == Acknowledgement::Failure &&
+        sparseGrid.Build(huge) == Acknowledgement::Failure &&
+        sparseGrid.Size() == 0 &&
+        grid.Build(positions.ExportAll()) == Acknowledgement::Success &&
+        grid.Size() == count;
+
+    std::wcout << L"SpatialGrid<" << sizeof(Floating) << L" byte> "
+               << (threeDimensional ? L"3D" : L"2D")
+               << L": matches brute force: " << (correct ? L"yes" : L"NO")
+               << L", parallel build matches: "
+               << (sameInParallel ? L"yes" : L"NO")
+               << L", updates: " << (updates ? L"yes" : L"NO")
+               << L", sparse and bad input: " << (refuses ? L"yes" : L"NO")
+               << '\n';
+}
+
+void TestSpatialGrids()
+{
+    using FluidEngine::Mathematics::VectorDimensions;
+
+    TestSpatialGrid<float>(VectorDimensions::D2);
+    TestSpatialGrid<float>(VectorDimensions::D3);
+    TestSpatialGrid<double>(VectorDimensions::D2);
+    TestSpatialGrid<double>(VectorDimensions::D3);
+    TestSpatialGrid<long double>(VectorDimensions::D3);
+}
+
+/**
+ * @brief Reads a whole file
+ *
+ */
+std::string ReadBytes(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string
+    (
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>()
+    );
+}
+
+/**
+ * @brief Writes bytes to path, replacing whatever was there
+ *
+ */
+void WriteBytes(const std::string& path, const std::string& bytes)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), (std::streamsize)bytes.size());
+}
+
+/**
+ * @brief Writes a snapshot, reads it back, and checks that broken snapshots
+ * are refused
+ *
+ * @tparam Floating
+ */
+template<typename Floating>
+void TestSnapshot()
+{
+    using namespace FluidEngine::Abstraction;
+    using namespace FluidEngine::Mathematics;
+    using namespace FluidEngine::Serialization;
+
+    const std::string path = "SnapshotTest.fesnap";
+    const std::string brokenPath = "SnapshotTestBroken.fesnap";
+
+    // more than SnapshotWriter::bufferedVectors, and not a multiple of it
+    const std::size_t count = 40009;
+    std::mt19937 generator(1939344);
+    std::uniform_real_distribution<Floating> distribution(-100, 100);
+    const std::wstring names[] = {L"Particle", L"Boundary", L"", L"été"};
+
+    std::vector<VectorBase<Floating>> vectors;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        vectors.push_back
+        (
+            VectorBase<Floating>
+            (
+                names[index % 4],
+                index % 3 == 0 ? VectorDimensions::D2 : VectorDimensions::D3,
+                index % 5 == 0 ? VectorFormatting::Plr : VectorFormatting::Rct,
+                distribution(generator),
+                distribution(generator),
+                index % 3 == 0 ?
+                    std::numeric_limits<Floating>::quiet_NaN() :
+                    distribution(generator)
+            )
+        );
+    }
+    // the values text tends to get wrong
+    vectors.push_back
+    (
+        VectorBase<Floating>::Generate3DRVectorWithName
+        (
+            L"Edge",
+            -0.0,
+            std::numeric_limits<Floating>::infinity(),
+            std::numeric_limits<Floating>::denorm_min()
+        )
+    );
+    VectorBatch<Floating> batch
+    (
+        L"Batch",
+        VectorDimensions::D2,
+        VectorFormatting::Rct
+    );
+    for (int index = 0; index < 100; ++index)
+    {
+        batch.Import
+        (
+            VectorBase<Floating>::Generate2DRVectorWithOutName(index, -index)
+        );
+    }
+
+    // no room is made up front, so the columns move a few times
+    SnapshotWriter<Floating> writer(L"Test Snapshot Writer");
+    bool written =
+        writer.Open(path) == Acknowledgement::Success &&
+        writer.Open(path, 1) == Acknowledgement::Failure;
+    for (const VectorBase<Floating>& vector : vectors)
+    {
+        written = written && writer.Write(vector) == Acknowledgement::Success;
+    }
+    written = written &&
+        writer.Write(batch) == Acknowledgement::Success &&
+        writer.Size() == vectors.size() + batch.Size() &&
+        writer.Close() == Acknowledgement::Success &&
+        writer.Close() == Acknowledgement::Failure &&
+        writer.Write(vectors[0]) == Acknowledgement::Failure;
+
+    // however much room was made, the file comes out the same
+    const auto writtenWith = [&](const std::size_t& capacity)
+    {
+        SnapshotWriter<Floating> sized;
+        sized.Open(brokenPath, capacity);
+        for (const VectorBase<Floating>& vector : vectors)
+        {
+            sized.Write(vector);
+        }
+        sized.Write(batch);
+        return sized.Close() == Acknowledgement::Success ?
+            ReadBytes(brokenPath) : std::string();
+    };
+    const std::string unsized = ReadBytes(path);
+    written = written && !unsized.empty() &&
+        writtenWith(vectors.size() + batch.Size()) == unsized &&
+        writtenWith(1 << 22) == unsized &&
+        writtenWith(SnapshotWriter<Floating>::bufferedVectors - 1) == unsized;
+
+    SnapshotReader<Floating> reader(L"Test Snapshot Reader");
+    bool roundTrips = reader.Open(path) == Acknowledgement::Success &&
+        reader.Size() == vectors.size() + batch.Size() &&
+        reader.GetNames().size() == 6;
+    for (std::size_t axis = 0; roundTrips && axis < 3; ++axis)
+    {
+        roundTrips = (std::uintptr_t)reader.GetColumn(axis).data() %
+            snapshotAlignment == 0;
+    }
+    for (std::size_t index = 0; roundTrips && index < vectors.size(); ++index)
+    {
+        const VectorBase<Floating> exported = reader.Export(index);
+        roundTrips =
+            exported.GetReferenceName() ==
+                vectors[index].GetReferenceName() &&
+            exported.GetDimensions() == vectors[index].GetDimensions() &&
+            exported.GetFormatting() == vectors[index].GetFormatting();
+        for (std::size_t axis = 0; axis < 3; ++axis)
+        {
+            roundTrips = roundTrips && SameValue
+            (
+                reader.GetColumn(axis)[index],
+                vectors[index].GetCoordinates()[axis]
+            );
+        }
+    }
+    const std::vector<VectorBase<Floating>> exported = reader.ExportAll();
+    for (std::size_t index = 0; roundTrips && index < batch.Size(); ++index)
+    {
+        const VectorBase<Floating>& vector = exported[vectors.size() + index];
+        roundTrips = vector.GetReferenceName() == L"Batch" &&
+            vector.GetDimensions() == VectorDimensions::D2 &&
+            SameValue(vector.GetCoordinates()[0], batch.GetColumn(0)[index]) &&
+            SameValue(vector.GetCoordinates()[1], batch.GetColumn(1)[index]) &&
+            std::isnan(vector.GetCoordinates()[2]);
+    }
+    reader.Close();
+    roundTrips = roundTrips && reader.Size() == 0 &&
+        reader.GetColumn(0).empty();
+
+    // every way a file can be broken has to be refused
+    const std::string good = ReadBytes(path);
+    SnapshotHeader header;
+    std::memcpy(&header, good.data(), sizeof(header));
+    const auto refuses = [&](std::string bytes)
+    {
+        WriteBytes(brokenPath, bytes);
+        return reader.Open(brokenPath) == Acknowledgement::Failure &&
+            reader.Size() == 0;
+    };
+
+    std::string badMagic = good;
+    badMagic[0] = 'X';
+    std::string flippedHeader = good;
+    flippedHeader[offsetof(SnapshotHeader, nameCount)] ^= 1;
+    std::string flippedName = good;
+    flippedName[header.nameTableOffset + 4] ^= 1;
+    std::string badIndex = good;
+    const std::uint32_t outOfRange = header.nameCount;
+    std::memcpy
+    (
+        badIndex.data() + header.nameIndexOffset + 4 * 7,
+        &outOfRange,
+        sizeof(outOfRange)
+    );
+    std::string badTag = good;
+    badTag[header.tagOffset + 3] = 4;
+
+    using OtherFloating =
+        std::conditional_t<std::is_same_v<Floating, float>, double, float>;
+    SnapshotReader<OtherFloating> otherReader;
+
+    const bool refusesBroken =
+        !refuses(good) &&
+        refuses(badMagic) &&
+        refuses(good.substr(0, good.size() - 1)) &&
+        refuses(good.substr(0, sizeof(SnapshotHeader) - 1)) &&
+        refuses(good + '\0') &&
+        refuses("") &&
+        refuses(flippedHeader) &&
+        refuses(flippedName) &&
+        refuses(badIndex) &&
+        refuses(badTag) &&
+        otherReader.Open(path) == Acknowledgement::Failure &&
+        reader.Open("NoSuchSnapshot.fesnap") == Acknowledgement::Failure &&
+        reader.Open(path) == Acknowledgement::Success;
+
+    reader.Close();
+    std::remove(path.c_str());
+    std::remove(brokenPath.c_str());
+
+    std::wcout << L"Snapshot<" << sizeof(Floating) << L" byte>: written: "
+               << (written ? L"yes" : L"NO")
+               << L", round trips: " << (roundTrips ? L"yes" : L"NO")
+               << L", refuses broken files: "
+               << (refusesBroken ? L"yes" : L"NO")
+               << L" (" << good.size() << L" bytes)\n";
+}
+
+void TestSnapshots()
+{
+    TestSnapshot<float>();
+    TestSnapshot<double>();
+    TestSnapshot<long double>();
+}
+
+/**
+ * @brief Checks FixedVector at compile time and against VectorBase
+ *
+ */
+void TestFixedVector()
+{
+    using namespace FluidEngine::Mathematics;
+
+    // all of this has to work at compile time
+    constexpr RectangularVector3<double> three(3, 4, 12);
+    static_assert(three.Magnitude() == 169);
+    static_assert(three.NormalizedForm().coordinates[2] == 12.0 / 13.0);
+    static_assert(three.CompressToTwoDimensions().Magnitude() == 25);
+    static_assert
+    (
+        (three + three - three) * three / three == three
+    );
+    static_assert
+    (
+        RectangularVector2<float>(1, -1).Reflection
+        (
+            RectangularVector2<float>(0, 1)
+        ) == RectangularVector2<float>(1, 1)
+    );
+
+    bool matchesVectorBase = true;
+    const VectorBase<double> vector =
+        VectorBase<double>::Generate3DRVectorWithOutName(1.5, -2.25, 7);
+    VectorBase<double> exact = vector.NormalizedForm();
+    VectorBase<double> fast = vector.FastNormalize();
+    VectorBase<double> polar = vector.AsPolar();
+    const RectangularVector3<double> fixed(vector);
+
+    for (std::size_t axis = 0; axis < 3; ++axis)
+    {
+        matchesVectorBase = matchesVectorBase &&
+            fixed.NormalizedForm().coordinates[axis] ==
+                exact.GetCoordinates()[axis] &&
+            fixed.FastNormalize().coordinates[axis] ==
+                fast.GetCoordinates()[axis] &&
+            fixed.AsPolar().coordinates[axis] ==
+                polar.GetCoordinates()[axis] &&
+            PolarVector3<double>(vector).coordinates[axis] ==
+                polar.GetCoordinates()[axis];
+    }
+    matchesVectorBase = matchesVectorBase &&
+        fixed.Magnitude() == vector.Magnitude() &&
+        static_cast<VectorBase<double>>(fixed).GetDimensions() ==
+            VectorDimensions::D3 &&
+        std::isnan
+        (
+            RectangularVector2<double>(1, 2).ToVectorBase().GetCoordinates()[2]
+        );
+
+    std::wcout << L"FixedVector matches VectorBase: "
+               << (matchesVectorBase ? L"yes" : L"NO") << '\n';
+}
+
+/**
+ * @brief Worst relative error of FastInverseSquareRoot over some numbers
+ *
+ */
+template<typename Floating>
+double WorstInverseSquareRootError
+(
+    std::span<const Floating> numbers,
+    std::span<const Floating> results
+)
+{
+    // enough extra digits to measure the error of Floating
+    using Wider = std::conditional_t
+    <
+        std::is_same<Floating, float>::value, double, long double
+    >;
+
+    Wider worst = 0;
+    for (std::size_t index = 0; index < results.size(); ++index)
+    {
+        // |y - 1 / sqrt(x)| / (1 / sqrt(x)), without dividing
+        const Wider error = std::fabs
+        (
+            (Wider)results[index] * std::sqrt((Wider)numbers[index]) - 1
+        );
+        worst = std::max(worst, error);
+    }
+    return (double)worst;
+}
+
+/**
+ * @brief Holds the batch FastInverseSquareRoot of every positive normal
+ * float (all ~2.1 billion of them) against its documented maximum error, on
+ * every path this CPU has, along with the scalar one. double and long double
+ * get random samples instead.
+ */
+void TestFastInverseSquareRoot()
+{
+    using namespace FluidEngine::Mathematics;
+    using FluidEngine::Abstraction::Acknowledgement;
+
+    // has to work at compile time, which also means no undefined behavior
+    static_assert(FastInverseSquareRoot(4.0l) == 0.5l);
+    static_assert(FastInverseSquareRoot(0x1p-16000l) == 0x1p8000l);
+    static_assert(FastInverseSquareRoot(0.25f, 3) - 2.0f < 1e-6f);
+
+    const std::uint32_t firstNormal = 0x00800000;
+    const std::uint32_t infinity = 0x7f800000;
+    // not a multiple of any SIMD width, so that the tails get tested too
+    const std::size_t chunk = (1 << 16) - 3;
+    std::vector<float> numbers(chunk);
+    std::vector<float> results(chunk);
+    std::vector<float> scalarResults(chunk);
+
+    for (InstructionSet instructionSet :
+        {InstructionSet::Scalar, InstructionSet::SSE2, InstructionSet::AVX2})
+    {
+        if (ForceInstructionSet(instructionSet) == Acknowledgement::Failure)
+        {
+            continue;
+        }
+
+        double worst = 0;
+        double worstScalar = 0;
+        for (std::uint32_t bits = firstNormal; bits < infinity; bits += chunk)
+        {
+            const std::size_t count =
+                std::min<std::size_t>(chunk, infinity - bits);
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                numbers[index] = std::bit_cast<float>(bits + (uint32_t)index);
+            }
+            const std::span<const float> in(numbers.data(), count);
+
+            BatchKernels::FastInverseSquareRoot<float>
+            (
+                in, std::span<float>(results.data(), count)
+            );
+            worst = std::max(worst, WorstInverseSquareRootError<float>
+            (
+                in, std::span<const float>(results.data(), count)
+            ));
+
+            if (instructionSet == InstructionSet::Scalar)
+            {
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    scalarResults[index] = FastInverseSquareRoot(numbers[index]);
+                }
+                worstScalar = std::max(worstScalar, WorstInverseSquareRootError
+                (
+                    in, std::span<const float>(scalarResults.data(), count)
+                ));
+            }
+        }
+
+        const double bound =
+            BatchKernels::FastInverseSquareRootMaximumError<float>
+            (
+                instructionSet
+            );
+        std::wcout << L"FastInverseSquareRoot<float> "
+                   << (instructionSet == InstructionSet::Scalar ? L"Scalar" :
+                       instructionSet == InstructionSet::SSE2 ? L"SSE2" :
+                       L"AVX2")
+                   << L": worst error " << worst << L" of " << bound
+                   << L" over every float: "
+                   << (worst <= bound ? L"yes" : L"NO") << '\n';
+        if (instructionSet == InstructionSet::Scalar)
+        {
+            std::wcout << L"    one at a time: "
+                       << (worstScalar <= bound ? L"yes" : L"NO") << '\n';
+        }
+    }
+    ForceInstructionSet(DetectInstructionSet());
+
+    // doubles and long doubles all over their ranges, every iteration count
+    const std::size_t samples = 1 << 18;
+    std::mt19937_64 generator(1939344);
+    std::vector<double> doubles(samples);
+    std::vector<long double> longDoubles(samples);
+    for (std::size_t index = 0; index < samples; ++index)
+    {
+        doubles[index] = std::bit_cast<double>
+        (
+            0x0010000000000000 + generator() % 0x7fe0000000000000
+        );
+        longDoubles[index] = std::ldexp
+        (
+            (long double)doubles[index],
+            (int)(generator() % 30000) - 15000
+        );
+    }
+
+    bool withinBounds = true;
+    bool sameAsScalar = true;
+    std::vector<double> doubleResults(samples);
+    std::vector<long double> longDoubleResults(samples);
+    for (std::size_t iterations = 0; iterations <= 5; ++iterations)
+    {
+        BatchKernels::FastInverseSquareRoot<double>
+        (
+            doubles, doubleResults, iterations
+        );
+        BatchKernels::FastInverseSquareRoot<long double>
+        (
+            longDoubles, longDoubleResults, iterations
+        );
+
+        const InstructionSet active = ActiveInstructionSet();
+        withinBounds = withinBounds &&
+            WorstInverseSquareRootError<double>(doubles, doubleResults) <=
+                BatchKernels::FastInverseSquareRootMaximumError<double>
+                (
+                    active, iterations
+                ) &&
+            WorstInverseSquareRootError<long double>
+            (
+                longDoubles, longDoubleResults
+            ) <= BatchKernels::FastInverseSquareRootMaximumError<long double>
+                (
+                    active, iterations
+                );
+
+        for (std::size_t index = 0; index < samples; ++index)
+        {
+            sameAsScalar = sameAsScalar &&
+                doubleResults[index] ==
+                    FastInverseSquareRoot(doubles[index], iterations) &&
+                longDoubleResults[index] ==
+                    FastInverseSquareRoot(longDoubles[index], iterations);
+        }
+    }
+
+    using LongDoubleLimits = std::numeric_limits<long double>;
+    const bool specialValues =
+        FastInverseSquareRoot(0.0l) == LongDoubleLimits::infinity() &&
+        FastInverseSquareRoot(LongDoubleLimits::infinity()) == 0 &&
+        std::isnan(FastInverseSquareRoot(-1.0l)) &&
+        std::isnan(FastInverseSquareRoot(LongDoubleLimits::quiet_NaN()));
+
+    std::wcout << L"FastInverseSquareRoot<double / long double> within bounds: "
+               << (withinBounds ? L"yes" : L"NO")
+               << L", same as one at a time: "
+               << (sameAsScalar ? L"yes" : L"NO")
+               << L", long double 0 / inf / NaN: "
+               << (specialValues ? L"yes" : L"NO") << '\n';
+}
 
 int main()
 {
     TestFluidEngineMember();
+    TestFluidEngineMemberIdentity();
     std::wcout << "The above members have exited their scopes and are now deleted\n";
     TestFluidEngineShell();
     std::wcout << "The above members have exited their scopes and are now deleted\n";
+    TestVectorBatches();
+    TestVectorExpressions();
+    TestJobSystem();
+    TestInstrumentation();
+    TestSnapshots();
+    TestSpatialGrids();
+    TestFixedVector();
+    TestFastInverseSquareRoot();
     
 }
\ No newline at end of file